@@ -0,0 +1,384 @@
+/**
+ * @file corpus.cpp
+ * @brief Synthetic data model corpus generator.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "corpus.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace dmgbench;
+
+static const char* scalarTypes[] = {
+    "bool", "int8", "uint8", "int16", "uint16", "int32",
+    "uint32", "int64", "uint64", "float", "double", "string"
+};
+
+static const unsigned int NUM_SCALAR_TYPES = sizeof(scalarTypes) / sizeof(const char*);
+
+CorpusConfig::CorpusConfig() :
+    files(200),
+    dirs(8),
+    fanIn(3),
+    depth(4),
+    members(12),
+    loops(1),
+    ifs(1),
+    templates(10),
+    refs(2),
+    arrays(1),
+    seed(1),
+    benchmark(false)
+{
+}
+
+bool dmgbench::makePath(const std::string &path)
+{
+    if (path.empty())
+        return true;
+
+    struct stat st;
+    if (stat(path.c_str(), &st) == 0)
+        return S_ISDIR(st.st_mode);
+
+    size_t pos = path.find_last_of('/');
+    if (pos != std::string::npos && pos > 0)
+    {
+        if (!makePath(path.substr(0, pos)))
+            return false;
+    }
+
+    return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+void dmgbench::clearPath(const std::string &path)
+{
+    DIR *dir = opendir(path.c_str());
+    if (!dir)
+        return;
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            continue;
+
+        std::string child = path + "/" + entry->d_name;
+
+        struct stat st;
+        if (lstat(child.c_str(), &st) != 0)
+            continue;
+
+        if (S_ISDIR(st.st_mode))
+        {
+            clearPath(child);
+            rmdir(child.c_str());
+        }
+        else
+        {
+            unlink(child.c_str());
+        }
+    }
+
+    closedir(dir);
+}
+
+static void writeFile(const std::string &filename, const std::string &content)
+{
+    std::ofstream os(filename.c_str(), std::ios::out | std::ios::trunc);
+    if (!os)
+        throw std::runtime_error("unable to write " + filename);
+
+    os << content;
+}
+
+//! Write the datamodelgen config file and create the output folders.
+static void writeConfig(const std::string &path, const std::string &templatesPath, bool benchmark)
+{
+    static const char* outputs[] = { "displayer", "authority", "editor" };
+    for (const char *output : outputs)
+    {
+        std::string dir = path + "/out/" + output;
+        if (!makePath(dir))
+            throw std::runtime_error("unable to create " + dir);
+    }
+
+    std::ostringstream cfg;
+    cfg << "# generated by dmg-bench\n";
+    cfg << "version = 1\n";
+    cfg << "author = dmg-bench\n";
+    cfg << "displayer.namespace = lgc\n";
+    cfg << "authority.namespace = lgs\n";
+    cfg << "editor.namespace = lge\n";
+    cfg << "hppext = h\n";
+    cfg << "cppext = cpp\n";
+    cfg << "input = " << path << "/src\n";
+    for (const char *output : outputs)
+        cfg << output << ".output = " << path << "/out/" << output << "\n";
+    cfg << "templates = " << templatesPath << "\n";
+    if (benchmark)
+        cfg << "benchmark = true\n";
+
+    writeFile(path + "/datamodelgen", cfg.str());
+}
+
+namespace {
+
+//! Generated file description.
+struct FileDesc
+{
+    unsigned int index;
+    unsigned int layer;
+    bool isTemplate;
+
+    std::string name;       //!< data name (ModelN)
+    std::string dir;        //!< sub-directory (pkgD)
+
+    std::vector<unsigned int> imports;
+
+    std::string importName() const { return dir + "." + name; }
+    std::string relPath() const { return dir + "/" + name + ".dmg"; }
+};
+
+class CorpusBuilder
+{
+public:
+
+    CorpusBuilder(const CorpusConfig &config) :
+        m_config(config),
+        m_rand(config.seed)
+    {
+    }
+
+    void build()
+    {
+        unsigned int numLayers = m_config.depth + 1;
+        if (numLayers > m_config.files)
+            numLayers = m_config.files;
+
+        m_layerBegin.assign(numLayers + 1, 0);
+        for (unsigned int l = 0; l <= numLayers; ++l)
+            m_layerBegin[l] = (unsigned int)((unsigned long long)m_config.files * l / numLayers);
+
+        m_files.resize(m_config.files);
+
+        for (unsigned int l = 0; l < numLayers; ++l)
+        {
+            for (unsigned int i = m_layerBegin[l]; i < m_layerBegin[l+1]; ++i)
+            {
+                FileDesc &f = m_files[i];
+                f.index = i;
+                f.layer = l;
+                f.name = "Model" + std::to_string(i);
+                f.dir = "pkg" + std::to_string(m_config.dirs ? i % m_config.dirs : 0);
+                f.isTemplate = l == 0 && pick(100) < m_config.templates;
+
+                if (l > 0)
+                    pickImports(f, m_layerBegin[l-1], m_layerBegin[l]);
+            }
+        }
+    }
+
+    const std::vector<FileDesc>& files() const { return m_files; }
+
+    std::string render(const FileDesc &f)
+    {
+        std::ostringstream os;
+
+        os << "# " << f.name << " generated by dmg-bench (layer " << f.layer << ")\n";
+        os << "using type.Rect2i\n";
+
+        for (unsigned int j : f.imports)
+            os << "import " << m_files[j].importName() << "\n";
+
+        os << "\n";
+
+        const FileDesc *base = f.imports.empty() ? nullptr : &m_files[f.imports[0]];
+
+        if (f.isTemplate)
+            os << "template <KIND>\n";
+
+        os << "data " << f.name;
+        if (base)
+        {
+            os << " : " << base->name;
+            if (base->isTemplate)
+                os << "<" << (f.index % 4) << ">";
+        }
+        os << "\n{\n";
+
+        os << "    public const uint32 MAX_" << f.name << " = " << (f.index + 1) << "\n\n";
+
+        // the identifier is inherited from the base data
+        if (!base)
+        {
+            os << "    identifier int32 m_id\n";
+
+            os << "\n    target displayer\n    {\n";
+            os << "        @identifier headers = \"../DataManager.h\"\n";
+            os << "        @identifier manager = DataManager::instance()\n";
+            os << "        @identifier method = *get" << f.name << "($id)\n";
+            os << "    }\n\n";
+        }
+
+        if (f.isTemplate)
+            os << "    uint32 m_kind = KIND\n";
+
+        for (unsigned int m = 0; m < m_config.members; ++m)
+        {
+            const char *type = scalarTypes[pick(NUM_SCALAR_TYPES)];
+            os << "    " << type << " m_" << type << m << "\n";
+        }
+
+        os << "    Rect2i m_area\n";
+        os << "    uint8[4] m_bytes\n";
+
+        // custom refs and arrays only target non template imported data
+        unsigned int numRefs = 0, numArrays = 0;
+        for (size_t k = 1; k < f.imports.size(); ++k)
+        {
+            const FileDesc &other = m_files[f.imports[k]];
+            if (other.isTemplate)
+                continue;
+
+            if (numRefs < m_config.refs)
+            {
+                os << "    " << other.name << "& m_ref" << other.name << "\n";
+                ++numRefs;
+            }
+            else if (numArrays < m_config.arrays)
+            {
+                os << "    " << other.name << "[] m_list" << other.name << "\n";
+                ++numArrays;
+            }
+        }
+
+        for (unsigned int n = 0; n < m_config.loops; ++n)
+        {
+            os << "\n    uint16 m_count" << n << "\n";
+            os << "    loop Item" << n << " : m_count" << n << "\n    {\n";
+            os << "        int32 m_value\n";
+            os << "        string m_label\n";
+            os << "        float m_weight\n";
+            os << "    }\n";
+        }
+
+        if (m_config.ifs)
+            os << "\n    bitset32 m_flags\n";
+
+        for (unsigned int n = 0; n < m_config.ifs; ++n)
+        {
+            os << "\n    if m_flags[HAS_OPT" << n << "]\n    {\n";
+            os << "        uint8 m_optCount" << n << "\n";
+            os << "        loop Opt" << n << " : m_optCount" << n << "\n        {\n";
+            os << "            uint32 m_key\n";
+            os << "            double m_value\n";
+            os << "        }\n";
+            os << "    }\n";
+        }
+
+        os << "}\n";
+
+        return os.str();
+    }
+
+private:
+
+    const CorpusConfig &m_config;
+    std::mt19937 m_rand;
+
+    std::vector<unsigned int> m_layerBegin;
+    std::vector<FileDesc> m_files;
+
+    unsigned int pick(unsigned int n)
+    {
+        return n ? (unsigned int)(m_rand() % n) : 0;
+    }
+
+    void pickImports(FileDesc &f, unsigned int begin, unsigned int end)
+    {
+        unsigned int count = end - begin;
+        unsigned int n = m_config.fanIn < count ? m_config.fanIn : count;
+
+        while (f.imports.size() < n)
+        {
+            unsigned int j = begin + pick(count);
+
+            bool found = false;
+            for (unsigned int k : f.imports)
+            {
+                if (k == j)
+                {
+                    found = true;
+                    break;
+                }
+            }
+
+            if (!found)
+                f.imports.push_back(j);
+        }
+    }
+};
+
+} // anonymous namespace
+
+std::string dmgbench::generateCorpus(
+        const std::string &path,
+        const std::string &templatesPath,
+        const CorpusConfig &config)
+{
+    if (config.files == 0)
+        throw std::invalid_argument("at least one file is necessary");
+
+    if (!makePath(path + "/src/type"))
+        throw std::runtime_error("unable to create " + path + "/src/type");
+
+    // start from a clean input tree, in case of a previous different shape
+    clearPath(path + "/src");
+    makePath(path + "/src/type");
+
+    writeConfig(path, templatesPath, config.benchmark);
+
+    writeFile(path + "/src/type/Rect2i.tdg",
+              "# Declaration of a type\n"
+              "typedef Rect2i\n"
+              "{\n"
+              "    header <o3d/core/Rect2.h>\n"
+              "    class o3d::Rect2i\n"
+              "}\n");
+
+    CorpusBuilder builder(config);
+    builder.build();
+
+    for (unsigned int d = 0; d < (config.dirs ? config.dirs : 1); ++d)
+        makePath(path + "/src/pkg" + std::to_string(d));
+
+    for (const FileDesc &f : builder.files())
+        writeFile(path + "/src/" + f.relPath(), builder.render(f));
+
+    // the last file is on the upper layer, nobody imports it
+    return "src/" + builder.files().back().relPath();
+}
+
+void dmgbench::generateEmptyCorpus(const std::string &path, const std::string &templatesPath)
+{
+    if (!makePath(path + "/src"))
+        throw std::runtime_error("unable to create " + path + "/src");
+
+    clearPath(path + "/src");
+    writeConfig(path, templatesPath, false);
+}
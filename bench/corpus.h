@@ -0,0 +1,69 @@
+/**
+ * @file corpus.h
+ * @brief Synthetic data model corpus generator.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _DMG_BENCH_CORPUS_H
+#define _DMG_BENCH_CORPUS_H
+
+#include <string>
+
+namespace dmgbench {
+
+/**
+ * @brief Shape of the generated corpus.
+ * Files are spread over depth+1 layers. Layer 0 files have no import, and each
+ * file of the layer n imports fanIn files of the layer n-1, so depth is the
+ * length of the longest import chain. Data of the upper layers inherit from
+ * their first import, reference the other ones (custom refs) and hold arrays of
+ * them.
+ */
+struct CorpusConfig
+{
+    CorpusConfig();
+
+    unsigned int files;          //!< number of .dmg files
+    unsigned int dirs;           //!< number of sub-directories where to spread them
+    unsigned int fanIn;          //!< number of imports per file (upper layers)
+    unsigned int depth;          //!< longest import chain
+    unsigned int members;        //!< scalar and string members per data
+    unsigned int loops;          //!< loops per data
+    unsigned int ifs;            //!< conditions per data, each one containing a loop
+    unsigned int templates;      //!< percent of layer 0 data declared as template
+    unsigned int refs;           //!< custom references per data (upper layers)
+    unsigned int arrays;         //!< custom arrays per data (upper layers)
+    unsigned int seed;           //!< random generator seed
+    bool benchmark;              //!< also generate the round-trip benchmark sources
+};
+
+/**
+ * @brief Generate the corpus into path : a datamodelgen config file, the
+ * src/ tree of .dmg files, a type/Rect2i.tdg typedef and empty out/ folders.
+ * @param path Root directory, created if necessary.
+ * @param templatesPath Absolute path of the generator templates.
+ * @return The relative path of a leaf file (used to simulate an incremental change).
+ */
+std::string generateCorpus(
+        const std::string &path,
+        const std::string &templatesPath,
+        const CorpusConfig &config);
+
+/**
+ * @brief Generate a project without any data file, to time the generator startup
+ * (exec, config and templates loading, until the first parse) and its exit.
+ */
+void generateEmptyCorpus(const std::string &path, const std::string &templatesPath);
+
+//! Create a directory and its parents. Return false on error.
+bool makePath(const std::string &path);
+
+//! Remove a directory content recursively (the directory itself is kept).
+void clearPath(const std::string &path);
+
+} // namespace dmgbench
+
+#endif // _DMG_BENCH_CORPUS_H
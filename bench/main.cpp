@@ -0,0 +1,373 @@
+/**
+ * @file main.cpp
+ * @brief dmg-bench, time the generator over a synthetic corpus.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "corpus.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace dmgbench;
+
+#ifndef DMG_BENCH_TEMPLATES
+#define DMG_BENCH_TEMPLATES "src/templates"
+#endif
+
+namespace {
+
+//! Result of a single generator run.
+struct RunResult
+{
+    double seconds;
+    long maxRssKb;
+    int status;
+};
+
+//! Measures of a scenario over the runs.
+struct Scenario
+{
+    std::string name;
+    std::vector<RunResult> runs;
+
+    double minTime() const
+    {
+        double r = runs.empty() ? 0.0 : runs[0].seconds;
+        for (const RunResult &run : runs)
+            r = std::min(r, run.seconds);
+        return r;
+    }
+
+    double medianTime() const
+    {
+        if (runs.empty())
+            return 0.0;
+
+        std::vector<double> times;
+        for (const RunResult &run : runs)
+            times.push_back(run.seconds);
+
+        std::sort(times.begin(), times.end());
+        return times[times.size() / 2];
+    }
+
+    long maxRss() const
+    {
+        long r = 0;
+        for (const RunResult &run : runs)
+            r = std::max(r, run.maxRssKb);
+        return r;
+    }
+};
+
+void usage()
+{
+    printf("Usage : dmg-bench --dmg <generator> [options]\n\n"
+           "Generate a synthetic corpus and time full, incremental and no-op regenerations.\n\n"
+           " --dmg <file>        Generator executable (required)\n"
+           " --dir <path>        Corpus location (default ./dmg-bench-corpus)\n"
+           " --templates <path>  Generator templates (default %s)\n"
+           " --runs <n>          Runs per scenario (default 3)\n"
+           " --startup-runs <n>  Runs of the generator on an empty project (default 20)\n"
+           " --json <file>       Also write the results as JSON\n"
+           " --keep-output       Do not silence the generator output\n"
+           " --benchmark         Generate the round-trip benchmark sources too\n"
+           " --files <n>         Number of .dmg files (default 200)\n"
+           " --dirs <n>          Sub-directories (default 8)\n"
+           " --fanin <n>         Imports per file (default 3)\n"
+           " --depth <n>         Longest import chain (default 4)\n"
+           " --members <n>       Scalar members per data (default 12)\n"
+           " --loops <n>         Loops per data (default 1)\n"
+           " --ifs <n>           Conditions, each with a nested loop, per data (default 1)\n"
+           " --templates-pct <n> Percent of template data on the first layer (default 10)\n"
+           " --refs <n>          Custom references per data (default 2)\n"
+           " --arrays <n>        Custom arrays per data (default 1)\n"
+           " --seed <n>          Random seed (default 1)\n",
+           DMG_BENCH_TEMPLATES);
+}
+
+std::string absolutePath(const std::string &path)
+{
+    if (!path.empty() && path[0] == '/')
+        return path;
+
+    char cwd[4096];
+    if (!getcwd(cwd, sizeof(cwd)))
+        throw std::runtime_error("unable to get the current directory");
+
+    return std::string(cwd) + "/" + path;
+}
+
+RunResult runGenerator(const std::string &dmg, const std::string &corpus, bool quiet)
+{
+    RunResult result = { 0.0, 0, -1 };
+
+    auto begin = std::chrono::steady_clock::now();
+
+    pid_t pid = fork();
+    if (pid < 0)
+        throw std::runtime_error("fork failed");
+
+    if (pid == 0)
+    {
+        if (quiet)
+        {
+            int fd = open("/dev/null", O_WRONLY);
+            if (fd >= 0)
+            {
+                dup2(fd, STDOUT_FILENO);
+                dup2(fd, STDERR_FILENO);
+                close(fd);
+            }
+        }
+
+        execl(dmg.c_str(), dmg.c_str(), corpus.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+
+    int status = 0;
+    struct rusage usage;
+    memset(&usage, 0, sizeof(usage));
+
+    if (wait4(pid, &status, 0, &usage) < 0)
+        throw std::runtime_error("wait4 failed");
+
+    auto end = std::chrono::steady_clock::now();
+
+    result.seconds = std::chrono::duration<double>(end - begin).count();
+#ifdef __APPLE__
+    result.maxRssKb = usage.ru_maxrss / 1024;
+#else
+    result.maxRssKb = usage.ru_maxrss;
+#endif
+    result.status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+
+    return result;
+}
+
+void touchSource(const std::string &filename, unsigned int n)
+{
+    std::ofstream os(filename.c_str(), std::ios::out | std::ios::app);
+    if (!os)
+        throw std::runtime_error("unable to modify " + filename);
+
+    os << "# incremental change " << n << "\n";
+}
+
+unsigned int toUInt(const char *str)
+{
+    char *end = nullptr;
+    unsigned long v = strtoul(str, &end, 10);
+    if (!end || *end != '\0')
+        throw std::invalid_argument(std::string("invalid integer ") + str);
+
+    return (unsigned int)v;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    CorpusConfig config;
+
+    std::string dmg;
+    std::string dir = "dmg-bench-corpus";
+    std::string templates = DMG_BENCH_TEMPLATES;
+    std::string json;
+    unsigned int numRuns = 3;
+    unsigned int numStartupRuns = 20;
+    bool quiet = true;
+
+    try {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if (arg == "--help" || arg == "-h")
+            {
+                usage();
+                return 0;
+            }
+            else if (arg == "--keep-output")
+            {
+                quiet = false;
+                continue;
+            }
+            else if (arg == "--benchmark")
+            {
+                config.benchmark = true;
+                continue;
+            }
+
+            if (i + 1 >= argc)
+                throw std::invalid_argument("missing value for " + arg);
+
+            const char *value = argv[++i];
+
+            if (arg == "--dmg")
+                dmg = value;
+            else if (arg == "--dir")
+                dir = value;
+            else if (arg == "--templates")
+                templates = value;
+            else if (arg == "--runs")
+                numRuns = toUInt(value);
+            else if (arg == "--startup-runs")
+                numStartupRuns = toUInt(value);
+            else if (arg == "--json")
+                json = value;
+            else if (arg == "--files")
+                config.files = toUInt(value);
+            else if (arg == "--dirs")
+                config.dirs = toUInt(value);
+            else if (arg == "--fanin")
+                config.fanIn = toUInt(value);
+            else if (arg == "--depth")
+                config.depth = toUInt(value);
+            else if (arg == "--members")
+                config.members = toUInt(value);
+            else if (arg == "--loops")
+                config.loops = toUInt(value);
+            else if (arg == "--ifs")
+                config.ifs = toUInt(value);
+            else if (arg == "--templates-pct")
+                config.templates = toUInt(value);
+            else if (arg == "--refs")
+                config.refs = toUInt(value);
+            else if (arg == "--arrays")
+                config.arrays = toUInt(value);
+            else if (arg == "--seed")
+                config.seed = toUInt(value);
+            else
+                throw std::invalid_argument("unknown option " + arg);
+        }
+
+        if (dmg.empty())
+        {
+            usage();
+            return 1;
+        }
+
+        if (numRuns == 0)
+            numRuns = 1;
+
+        dmg = absolutePath(dmg);
+        dir = absolutePath(dir);
+        templates = absolutePath(templates);
+
+        std::string leaf = generateCorpus(dir, templates, config);
+        generateEmptyCorpus(dir + "/empty", templates);
+
+        printf("corpus %s : %u files, fan-in %u, depth %u, %u members\n",
+               dir.c_str(), config.files, config.fanIn, config.depth, config.members);
+
+        Scenario full, incremental, noop, startup;
+        full.name = "full";
+        incremental.name = "incremental";
+        noop.name = "no-op";
+        startup.name = "startup";
+
+        for (unsigned int n = 0; n < numRuns; ++n)
+        {
+            // full : from empty output folders
+            clearPath(dir + "/out/displayer");
+            clearPath(dir + "/out/authority");
+            clearPath(dir + "/out/editor");
+
+            full.runs.push_back(runGenerator(dmg, dir, quiet));
+
+            // no-op : nothing changed since the previous run
+            noop.runs.push_back(runGenerator(dmg, dir, quiet));
+
+            // incremental : a single leaf file changed
+            touchSource(dir + "/" + leaf, n);
+            incremental.runs.push_back(runGenerator(dmg, dir, quiet));
+        }
+
+        // startup : exec, config and templates loading, no data file, exit
+        for (unsigned int n = 0; n < numStartupRuns; ++n)
+            startup.runs.push_back(runGenerator(dmg, dir + "/empty", quiet));
+
+        const Scenario* scenarios[] = { &full, &incremental, &noop, &startup };
+        const size_t numScenarios = sizeof(scenarios) / sizeof(const Scenario*);
+
+        int status = 0;
+
+        printf("%-12s %10s %10s %12s\n", "scenario", "min (s)", "median (s)", "peak RSS (KB)");
+        for (const Scenario *s : scenarios)
+        {
+            printf("%-12s %10.3f %10.3f %12ld\n", s->name.c_str(), s->minTime(), s->medianTime(), s->maxRss());
+
+            for (const RunResult &run : s->runs)
+            {
+                if (run.status != 0)
+                    status = 2;
+            }
+        }
+
+        if (!startup.runs.empty())
+            printf("startup median %.3f ms (target < 5 ms)\n", startup.medianTime() * 1000.0);
+
+        if (status != 0)
+            fprintf(stderr, "warning: at least one generator run failed\n");
+
+        if (!json.empty())
+        {
+            std::ofstream os(json.c_str(), std::ios::out | std::ios::trunc);
+            if (!os)
+                throw std::runtime_error("unable to write " + json);
+
+            os << "{\n  \"files\": " << config.files
+               << ",\n  \"fanIn\": " << config.fanIn
+               << ",\n  \"depth\": " << config.depth
+               << ",\n  \"members\": " << config.members
+               << ",\n  \"loops\": " << config.loops
+               << ",\n  \"ifs\": " << config.ifs
+               << ",\n  \"templates\": " << config.templates
+               << ",\n  \"refs\": " << config.refs
+               << ",\n  \"arrays\": " << config.arrays
+               << ",\n  \"seed\": " << config.seed
+               << ",\n  \"scenarios\": [\n";
+
+            for (size_t k = 0; k < numScenarios; ++k)
+            {
+                const Scenario *s = scenarios[k];
+                os << "    {\"name\": \"" << s->name << "\", \"runs\": [";
+
+                for (size_t r = 0; r < s->runs.size(); ++r)
+                {
+                    const RunResult &run = s->runs[r];
+                    os << (r ? ", " : "") << "{\"seconds\": " << run.seconds
+                       << ", \"maxRssKb\": " << run.maxRssKb
+                       << ", \"status\": " << run.status << "}";
+                }
+
+                os << "]}" << (k + 1 < numScenarios ? "," : "") << "\n";
+            }
+
+            os << "  ]\n}\n";
+        }
+
+        return status;
+    } catch (std::exception &e) {
+        fprintf(stderr, "dmg-bench: %s\n", e.what());
+        return 1;
+    }
+}
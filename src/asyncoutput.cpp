@@ -0,0 +1,156 @@
+/**
+ * @file asyncoutput.cpp
+ * @brief Output sink writing the generated files from a dedicated thread.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "asyncoutput.h"
+
+#include <algorithm>
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+AsyncOutputSink::AsyncOutputSink(OutputSink &output, Stats &stats) :
+    m_output(output),
+    m_stats(stats),
+    m_busy(False),
+    m_stop(False)
+{
+    m_thread = std::thread(&AsyncOutputSink::run, this);
+}
+
+AsyncOutputSink::~AsyncOutputSink()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = True;
+    }
+
+    m_wakeUp.notify_all();
+    m_thread.join();
+}
+
+Bool AsyncOutputSink::exists(const String &filename)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending.find(filename) != m_pending.end())
+            return True;
+    }
+
+    return m_output.exists(filename);
+}
+
+void AsyncOutputSink::write(const String &filename, TextBuffer content)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Pending pending;
+        pending.filename = filename;
+        pending.content = std::move(content);
+
+        m_queue.push_back(std::move(pending));
+        m_pending.insert(filename);
+    }
+
+    m_wakeUp.notify_one();
+}
+
+Bool AsyncOutputSink::isSame(const String &filename, const TextBuffer &content)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending.find(filename) != m_pending.end())
+            return False;
+    }
+
+    return m_output.isSame(filename, content);
+}
+
+void AsyncOutputSink::read(const String &filename, T_StringList &lines)
+{
+    Bool queued;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        queued = m_pending.find(filename) != m_pending.end();
+    }
+
+    if (queued)
+        flush();
+
+    m_output.read(filename, lines);
+}
+
+void AsyncOutputSink::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this] () { return m_queue.empty() && !m_busy; });
+
+    if (m_error)
+    {
+        std::exception_ptr error = m_error;
+        m_error = nullptr;
+
+        std::rethrow_exception(error);
+    }
+}
+
+void AsyncOutputSink::run()
+{
+    std::deque<Pending> batch;
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;)
+    {
+        m_wakeUp.wait(lock, [this] () { return m_stop || !m_queue.empty(); });
+
+        // stopped, and everything is written
+        if (m_queue.empty())
+            break;
+
+        batch.swap(m_queue);
+        m_busy = True;
+
+        lock.unlock();
+
+        std::sort(batch.begin(), batch.end(), [] (const Pending &a, const Pending &b) {
+            return a.filename < b.filename;
+        });
+
+        std::exception_ptr error;
+        {
+            StatsScope scope(m_stats, "write batch", "<output>", Stats::PHASE_WRITE);
+
+            // the contents are given to the output, the names are kept for m_pending
+            for (Pending &pending : batch)
+            {
+                try {
+                    m_output.write(pending.filename, std::move(pending.content));
+                } catch (...) {
+                    error = std::current_exception();
+                    break;
+                }
+            }
+        }
+
+        lock.lock();
+
+        for (const Pending &pending : batch)
+        {
+            m_pending.erase(m_pending.find(pending.filename));
+        }
+
+        batch.clear();
+
+        if (error && !m_error)
+            m_error = error;
+
+        m_busy = False;
+        m_idle.notify_all();
+    }
+}
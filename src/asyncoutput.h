@@ -0,0 +1,89 @@
+/**
+ * @file asyncoutput.h
+ * @brief Output sink writing the generated files from a dedicated thread.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _O3D_DMG_ASYNCOUTPUT_H
+#define _O3D_DMG_ASYNCOUTPUT_H
+
+#include "provider.h"
+#include "stats.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace o3d {
+namespace dmg {
+
+/**
+ * @brief Queue the generated files and give them to another sink from a writer
+ * thread, so the render does not wait for the files system. The writer takes the
+ * whole queue at once and writes it sorted by name, so the files of a folder are
+ * written together.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class AsyncOutputSink : public OutputSink
+{
+public:
+
+    //! Start the writer thread.
+    AsyncOutputSink(OutputSink &output, Stats &stats);
+
+    //! Write the queued files and stop the writer thread. An error is ignored.
+    virtual ~AsyncOutputSink();
+
+    //! True if queued, else asked to the output.
+    virtual Bool exists(const String &filename) override;
+
+    //! Queue the content, moved, and return immediately.
+    virtual void write(const String &filename, TextBuffer content) override;
+
+    //! False if queued, else asked to the output.
+    virtual Bool isSame(const String &filename, const TextBuffer &content) override;
+
+    //! Wait for the queued files if it is one of them, then read it from the output.
+    virtual void read(const String &filename, T_StringList &lines) override;
+
+    //! Wait until the queued files are written. Rethrow the first write error.
+    void flush();
+
+private:
+
+    struct Pending
+    {
+        String filename;
+        TextBuffer content;
+    };
+
+    OutputSink &m_output;
+    Stats &m_stats;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;   //!< something queued, or stop
+    std::condition_variable m_idle;     //!< queue written
+
+    std::deque<Pending> m_queue;
+    std::multiset<String> m_pending;    //!< queued or being written names
+
+    Bool m_busy;
+    Bool m_stop;
+    std::exception_ptr m_error;
+
+    std::thread m_thread;
+
+    void run();
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_ASYNCOUTPUT_H
@@ -10,7 +10,7 @@
 #ifndef _O3D_DMG_CONTEXT_H
 #define _O3D_DMG_CONTEXT_H
 
-#include <o3d/core/outstream.h>
+#include "textbuffer.h"
 
 namespace o3d {
 namespace dmg {
@@ -26,7 +26,7 @@ class Context
 {
 public:
 
-    OutStream *os;
+    TextBuffer *os;
 
     Data *data;
 
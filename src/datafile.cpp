@@ -8,31 +8,39 @@
  */
 
 #include "datafile.h"
-#include "main.h"
-#include <o3d/core/localfile.h>
+#include "generator.h"
 #include <o3d/core/filemanager.h>
 #include <o3d/core/integer.h>
 #include <o3d/core/char.h>
-#include <o3d/core/localdir.h>
 #include <o3d/core/stringtokenizer.h>
 #include <o3d/gui/integervalidator.h>
 #include "memberfactory.h"
 #include "membercustomref.h"
 #include "membercustomarray.h"
+#include "memberloop.h"
+#include "memberstring.h"
 #include "tokenizer.h"
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+
 using namespace o3d;
 using namespace o3d::dmg;
 
 DataFile::DataFile(
+        Generator &generator,
         const String &path,
         const String &filename,
         const String &suffix,
         Bool composite) :
+    m_generator(generator),
     m_composite(composite),
     m_pathname(path),
     m_filename(filename),
-    m_suffix(suffix)
+    m_suffix(suffix),
+    m_encoded(False),
+    m_encodedTypes(False)
 {
     Int32 s = m_filename.reverseFind('/');  
     m_prefix = m_filename.sub(s+1, m_filename.length() - 4);
@@ -41,7 +49,7 @@ DataFile::DataFile(
     m_pathname.replace('/', '.');
 
     // update the CPP reader headers
-    UInt32 u = Main::instance()->getInPath().count('/');
+    UInt32 u = m_generator.getInPath().count('/');
     UInt32 v = m_filename.count('/');
 
     m_relPath = "";
@@ -88,55 +96,114 @@ Member *Data::getMember(const String &name)
     return nullptr;
 }
 
+//! True if a member, or a child of a loop or an if, is a variable length integer.
+static Bool hasEncoded(const T_MemberList &members)
+{
+    for (const Member *member : members)
+    {
+        if (member->isEncoded())
+            return True;
+
+        if (member->getChildren() && hasEncoded(*member->getChildren()))
+            return True;
+    }
+
+    return False;
+}
+
+//! True if a member, or a child of a loop or an if, is of a member type (@see Member::Type).
+static Bool hasType(const T_MemberList &members, UInt32 type)
+{
+    for (const Member *member : members)
+    {
+        if (member->getType() == type)
+            return True;
+
+        if (member->getChildren() && hasType(*member->getChildren(), type))
+            return True;
+    }
+
+    return False;
+}
+
 const String &DataFile::getName() const
 {
     return m_prefix;
 }
 
+String DataFile::getOutFileName(const String &outPath, const String &name) const
+{
+    if (m_pathname.isValid())
+        return outPath + "/" + m_pathname + "/" + name;
+    else
+        return outPath + "/" + name;
+}
+
 void DataFile::parseTypedefFile()
 {
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::parseTypedefFile", m_filename, Stats::PHASE_PASS0);
+
     System::print(m_filename, "Parse type def file");
 
-    InStream *is = FileManager::instance()->openInStream(m_filename);
+    T_StringList lines;
+    m_generator.getSourceProvider().read(m_filename, lines);
+
+    TextReader reader(lines);
+    stats.addBytesRead(m_filename, reader.getSize());
+
+    m_stamp = m_generator.getStamp(Generator::hashContent(lines));
 
     // simple and unique pass
     try {
-        parseTypedefFile(is);
+        parseTypedefFile(&reader);
     } catch (E_BaseException &e)
     {
         System::print(e.getMsg(), e.getDescr() + " in " + m_filename, System::MSG_ERROR);
-
-        deletePtr(is);
         O3D_ERROR(E_InvalidFormat(String("Error parsing ") + m_filename));
     }
-
-    deletePtr(is);
 }
 
 void DataFile::parseClassFile()
 {
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::parseClassFile", m_filename, Stats::PHASE_NONE);
+
     System::print(m_filename, "Parse data file");
 
-    InStream *is = FileManager::instance()->openInStream(m_filename);
+    T_StringList lines;
+    m_generator.getSourceProvider().read(m_filename, lines);
+
+    TextReader reader(lines);
+    stats.addBytesRead(m_filename, reader.getSize());
+
+    m_stamp = m_generator.getStamp(Generator::hashContent(lines));
+
+    // only the main file, the imports are indexed by their own parse
+    m_generator.getXRefIndex().scan(m_filename.sub(m_generator.getInPath().length() + 1, -1), lines);
 
     try {
         // first pass... resolve imports and objects names
-        parseClassFile(is, 0, 0);
-        is->reset(0);
+        {
+            StatsScope passScope(stats, "pass0", m_filename, Stats::PHASE_PASS0);
+            parseClassFile(&reader, 0, 0);
+        }
+
+        reader.reset();
         // reset list of parsed file, before doing the second pass...
         m_importedDmg.clear();
+
         // second pass... parse content of objects
-        parseClassFile(is, 0, 1);
+        {
+            StatsScope passScope(stats, "pass1", m_filename, Stats::PHASE_PASS1);
+            parseClassFile(&reader, 0, 1);
+        }
     } catch (E_BaseException &e)
     {
         System::print(e.getMsg(), e.getDescr() + " in " + m_filename, System::MSG_ERROR);
-
-        deletePtr(is);
         O3D_ERROR(E_InvalidFormat(String("Error parsing ") + m_filename));
     }
 
-    deletePtr(is);
-
     // compute the min size of each data
     for (std::pair<String, Data*> data : m_data)
     {
@@ -150,31 +217,32 @@ void DataFile::parseClassFile()
     }
 }
 
-void DataFile::process()
+void DataFile::link()
 {
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::link", m_filename, Stats::PHASE_PROCESS);
+
     System::print(m_filename, "Process data file");
 
-    // attribute id to objects
+    // attribute id to objects, the same for a data whatever the importing file
     for (std::pair<String, Data*> entry : m_data)
     {
         // auto id
         if (entry.second->id == 0)
-            entry.second->id = Main::instance()->getNextDataId();
+            entry.second->id = m_generator.getDataId(entry.first);
     }
 
     for (Data *data : m_ref)
     {
         for (UInt32 t = 0; t < 4; ++t)
         {
-            m_currentType = (TargetType)t;
-
             T_StringList headers;
             for (const String &h : data->identifierMeta[t].defaultEntry.headers)
             {
                 headers.push_back("\"" + m_relPath + h + "\"");
             }
 
-            updateHeader(headers, F_CPP);
+            updateHeader((TargetType)t, headers, F_CPP);
         }
     }
 
@@ -187,6 +255,13 @@ void DataFile::process()
         Data *pdata = data->directInherit;
         while (pdata)
         {
+            // initialized by the constructor of the class template
+            if (isExplicitTemplate(pdata))
+            {
+                pdata = pdata->directInherit;
+                continue;
+            }
+
             for (UInt32 i = 0; i < 4; ++i)
             {
                 for (Member *m : pdata->members[i])
@@ -225,31 +300,76 @@ void DataFile::process()
                 }
             }
         }
+
+        // derived names of the members
+        for (UInt32 t = 0; t < 4; ++t)
+        {
+            for (Member *member : data->members[t])
+            {
+                member->link();
+            }
+
+            // the implementations include the DataEncoding header
+            if (!data->abstract && data->importLevel == 0 && hasEncoded(data->members[t]))
+                m_encoded = True;
+
+            // and the headers too
+            if (!data->abstract && data->importLevel == 0 &&
+                (hasType(data->members[t], Member::TYPE_STRINGVIEW) ||
+                 hasType(data->members[t], Member::TYPE_FIXED_STRING)))
+            {
+                m_encodedTypes = True;
+            }
+        }
+
+        // DataArena, DataArenaArray, DataArenaAllocator, DataPool, DataStringTable
+        if (data->importLevel == 0 &&
+            (m_generator.isArena() || m_generator.isPool() || m_generator.isPackStrings()))
+            m_encodedTypes = True;
     }
+}
 
-    // write for profiles
-    for (Int32 p = 0; p < 3; ++p)
-    {
-        Profile profile = (Profile)p;
+void DataFile::render(Profile profile) const
+{
+    static const char* renderNames[3] = { "render displayer", "render authority", "render editor" };
 
-        String outHppPath = Main::instance()->getOutHppPath(profile);
-        String outCppPath = Main::instance()->getOutCppPath(profile);
+    Stats &stats = m_generator.getStats();
+    StatsScope renderScope(stats, renderNames[profile], m_filename, Stats::Phase(Stats::PHASE_RENDER_DISPLAYER + profile));
 
-        // profile to target type
-        m_currentType = (TargetType)(p + 1);
+    String outHppPath = m_generator.getOutHppPath(profile);
+    String outCppPath = m_generator.getOutCppPath(profile);
 
-        if (profile == DISPLAYER || profile == AUTHORITY)
+    // with explicit templates, the implementation of the templates data is written apart
+    Int32 numImpls = m_generator.isExplicitTemplates() ? 2 : 1;
+
+    if (profile == DISPLAYER || profile == AUTHORITY)
+    {
+        writeDataReaderClass(outHppPath, m_generator.getHppExt(), profile);
+
+        for (Int32 n = 0; n < numImpls; ++n)
         {
-            writeDataReaderClass(outHppPath, Main::instance()->getHppExt(), profile);
-            writeDataReaderImpl(outCppPath, Main::instance()->getCppExt(), profile);
-            writeDataReaderUserImpl(outCppPath, Main::instance()->getCppExt(), profile);
+            writeDataReaderImpl(outCppPath, m_generator.getCppExt(), profile, n == 1);
+            writeDataReaderUserImpl(outCppPath, m_generator.getCppExt(), profile, n == 1);
         }
-        else if (profile == EDITOR)
+    }
+    else if (profile == EDITOR)
+    {
+        writeDataWriterClass(outHppPath, m_generator.getHppExt(), profile);
+
+        for (Int32 n = 0; n < numImpls; ++n)
         {
-            writeDataWriterClass(outHppPath, Main::instance()->getHppExt(), profile);
-            writeDataWriterImpl(outCppPath, Main::instance()->getCppExt(), profile);
+            writeDataWriterImpl(outCppPath, m_generator.getCppExt(), profile, n == 1);
         }
     }
+
+    if (m_generator.isBenchmark())
+        writeDataBench(outCppPath, m_generator.getCppExt(), profile);
+
+    if (m_encoded)
+        m_generator.registerEncoding(profile);
+
+    if (m_generator.isReport())
+        m_generator.registerReport(profile, getReport(profile));
 }
 
 void DataFile::addMember(TargetType type, const String &name, Member *member)
@@ -289,7 +409,7 @@ void DataFile::addMember(
     }
 }
 
-void DataFile::parseClassFile(InStream *is, UInt32 importLevel, Int32 pass)
+void DataFile::parseClassFile(TextReader *is, UInt32 importLevel, Int32 pass)
 {
     String line;
     m_is = is;
@@ -356,7 +476,7 @@ void DataFile::parseClassFile(InStream *is, UInt32 importLevel, Int32 pass)
     }
 }
 
-void DataFile::parseTypedefFile(InStream *is)
+void DataFile::parseTypedefFile(TextReader *is)
 {
     String line;
     m_is = is;
@@ -410,7 +530,7 @@ void DataFile::importTypedef(const String &_line, Int32 pass)
 
     name.replace('.', '/');
 
-    String filename = Main::instance()->getInPath() + "/" + name + ".tdg";
+    String filename = m_generator.getInPath() + "/" + name + ".tdg";
 
     // avoid redondant cyclic imports
     for (String &fname : m_importedDmg)
@@ -419,21 +539,24 @@ void DataFile::importTypedef(const String &_line, Int32 pass)
             return;
     }
 
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::importTypedef", m_filename, Stats::PHASE_IMPORT);
+
     System::print(filename, "Import type def file");
 
-    InStream *is = FileManager::instance()->openInStream(filename);
+    T_StringList lines;
+    m_generator.getSourceProvider().read(filename, lines);
+
+    TextReader reader(lines);
+    stats.addBytesRead(m_filename, reader.getSize());
 
     try {
-        parseTypedefFile(is);
+        parseTypedefFile(&reader);
     } catch (E_BaseException &e)
     {
         System::print(e.getMsg(), e.getDescr() + " in " + filename, System::MSG_ERROR);
-
-        deletePtr(is);
         O3D_ERROR(E_InvalidFormat(String("Error parsing ") + filename));
     }
-
-    deletePtr(is);
 }
 
 void DataFile::importData(const String &_line, UInt32 importLevel, Int32 pass)
@@ -454,7 +577,7 @@ void DataFile::importData(const String &_line, UInt32 importLevel, Int32 pass)
 
     name.replace('.', '/');
 
-    String filename = Main::instance()->getInPath() + "/" + name + ".dmg";
+    String filename = m_generator.getInPath() + "/" + name + ".dmg";
 
     // cannot import itself
     if (filename == m_filename)
@@ -467,19 +590,24 @@ void DataFile::importData(const String &_line, UInt32 importLevel, Int32 pass)
             return;
     }
 
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::importData", m_filename, Stats::PHASE_IMPORT);
+
     System::print(filename, "Import data file");
 
-    InStream *is = FileManager::instance()->openInStream(filename);
+    T_StringList lines;
+    m_generator.getSourceProvider().read(filename, lines);
+
+    TextReader reader(lines);
+    stats.addBytesRead(m_filename, reader.getSize());
 
     try {
         if (m_pathname.isValid())
         {
-            String fin = FileManager::instance()->getFullFileName(filename);
-            String fcn = FileManager::instance()->getFullFileName(m_filename);
-
+            // both are built from the input path
             String ap, bp, af, bf;
-            FileManager::getFileNameAndPath(fin, af, ap);
-            FileManager::getFileNameAndPath(fcn, bf, bp);
+            FileManager::getFileNameAndPath(filename, af, ap);
+            FileManager::getFileNameAndPath(m_filename, bf, bp);
 
             String a = ap;
             a.remove(bp);
@@ -540,7 +668,7 @@ void DataFile::importData(const String &_line, UInt32 importLevel, Int32 pass)
             if (pass == 0)
                 m_imports.push_back(m_currentImport);
 
-            m_currentImport += "Data." + Main::instance()->getHppExt();
+            m_currentImport += "Data." + m_generator.getHppExt();
         }
         else
         {
@@ -553,7 +681,7 @@ void DataFile::importData(const String &_line, UInt32 importLevel, Int32 pass)
             if (pass == 0)
                 m_imports.push_back(af);
 
-            m_currentImport = af + "Data." + Main::instance()->getHppExt();
+            m_currentImport = af + "Data." + m_generator.getHppExt();
         }
 
         // imported file
@@ -562,19 +690,15 @@ void DataFile::importData(const String &_line, UInt32 importLevel, Int32 pass)
 
         m_importedDmg.push_back(filename);
 
-        parseClassFile(is, importLevel, pass);
+        parseClassFile(&reader, importLevel, pass);
     } catch (E_BaseException &e)
     {
         System::print(e.getMsg(), e.getDescr() + " in " + filename, System::MSG_ERROR);
-
-        deletePtr(is);
         O3D_ERROR(E_InvalidFormat(String("Error parsing ") + filename));
     }
-
-    deletePtr(is);
 }
 
-void DataFile::parseTypeDef(InStream *is, const String &_line, Int32 pass)
+void DataFile::parseTypeDef(TextReader *is, const String &_line, Int32 pass)
 {
     Bool begin = False;
 
@@ -688,25 +812,25 @@ void DataFile::parseTypeDef(InStream *is, const String &_line, Int32 pass)
         member->setOutTypeName(outTypeName);
         member->setHeaders(headers);
 
-        MemberFactory::instance()->registerMember(member);
+        m_generator.getMemberFactory().registerMember(member);
 
         MemberCustomArray *memberArray = new MemberCustomArray(nullptr);
         memberArray->setTypeName(name + "[]");
         memberArray->setOutTypeName(outTypeName);
         memberArray->setHeaders(headers);
 
-        MemberFactory::instance()->registerMember(memberArray);
+        m_generator.getMemberFactory().registerMember(memberArray);
 
         MemberCustomRef *memberRef = new MemberCustomRef(nullptr);
         memberRef->setTypeName(name + "&");
         memberRef->setOutTypeName(outTypeName);
         memberRef->setHeaders(headers);
 
-        MemberFactory::instance()->registerMember(memberRef);
+        m_generator.getMemberFactory().registerMember(memberRef);
     }
 }
 
-void DataFile::parseIdentifier(InStream *is, const String &_line, Data *data)
+void DataFile::parseIdentifier(TextReader *is, const String &_line, Data *data)
 {
     Tokenizer tk(_line, "");
     String token;
@@ -751,7 +875,7 @@ void DataFile::parseIdentifier(InStream *is, const String &_line, Data *data)
         }
     }
 
-    Member *member = MemberFactory::instance()->buildFromTypeName(type, nullptr);
+    Member *member = m_generator.getMemberFactory().buildFromTypeName(type, nullptr);
     member->setName(name);
 
     // as identifier (must be unique)
@@ -764,7 +888,7 @@ void DataFile::parseIdentifier(InStream *is, const String &_line, Data *data)
     addMember(T_COMMON, data, member, nullptr);
 }
 
-void DataFile::parseTarget(InStream *is, const String &_line, Data *data)
+void DataFile::parseTarget(TextReader *is, const String &_line, Data *data)
 {
     Bool begin = False;
 
@@ -915,8 +1039,11 @@ void DataFile::parseTarget(InStream *is, const String &_line, Data *data)
     }
 }
 
-void DataFile::writeDataReaderClass(const String &outPath, const String &hppExt, Profile profile)
+void DataFile::writeDataReaderClass(const String &outPath, const String &hppExt, Profile profile) const
 {
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::writeDataReaderClass", m_filename, Stats::PHASE_NONE);
+
     // only if concrete message to export
     Bool something = False;
     for (std::pair<String, Data*> entry : m_data)
@@ -929,108 +1056,106 @@ void DataFile::writeDataReaderClass(const String &outPath, const String &hppExt,
     }
 
     if (!something)
-        return;
-
-    LocalDir dir(outPath + "/" + m_pathname);
-    if (!dir.exists())
     {
-        dir.cdUp();
-        dir.makeDir(m_pathname);
+        stats.addFileSkipped(m_filename);
+        return;
     }
 
-    String filename = FileManager::instance()->getFullFileName(outPath + "/" + m_pathname + "/" + m_prefix + "Data." + hppExt);
-    FileOutStream *os = FileManager::instance()->openOutStream(filename, FileOutStream::CREATE);
+    String filename = getOutFileName(outPath, m_prefix + "Data." + hppExt);
+
+    TextBuffer buffer;
 
+    for (const String &hppLine : m_generator.getTemplate(Generator::TPL_HPP))
+    {
+        String outLine = hppLine;
+        Int32 p1;
+        Int32 p2;
 
+        if (outLine.isEmpty())
+            buffer.writeLine("");
 
-    try {
-        for (const String &hppLine : Main::instance()->getTemplate(Main::TPL_HPP))
+        // block
+        else if ((p1 = outLine.sub("@{", 0)) != -1)
         {
-            String outLine = hppLine;
-            Int32 p1;
-            Int32 p2;
-
-            if (outLine.isEmpty())
-                os->writeLine("");
+            p1 = 0;
+            p2 = outLine.find('}', p1+2);
 
-            // block
-            else if ((p1 = outLine.sub("@{", 0)) != -1)
+            if (p2 == -1)
             {
-                p1 = 0;
-                p2 = outLine.find('}', p1+2);
+                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in hpp.template"));
+            }
 
-                if (p2 == -1)
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "license")
+            {
+                // license
+                for (const String &line : m_generator.getTemplate(Generator::TPL_LICENCE))
                 {
-                    deletePtr(os);
-                    O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in hpp.template"));
+                    buffer.writeLine(line);
                 }
-
-                String blockName = outLine.sub(p1+2, p2);
-                if (blockName == "license")
+            }
+            else if (blockName == "content")
+            {
+                // classes predeclarations
+                for (const String &clazz : m_preClass)
                 {
-                    // license
-                    for (const String &line : Main::instance()->getTemplate(Main::TPL_LICENCE))
-                    {
-                        os->writeLine(line);
-                    }
+                    buffer.writeLine("class " + clazz + ";");
                 }
-                else if (blockName == "content")
-                {
-                    // classes predeclarations
-                    for (String &clazz : m_preClass)
-                    {
-                        os->writeLine("class " + clazz + ";");
-                    }
 
-                    if (m_preClass.size())
-                        os->writeLine("");
+                if (m_preClass.size())
+                    buffer.writeLine("");
 
-                    // classes
-                    for (std::pair<String,Data*> entry : m_data)
-                    {
-                        if (!entry.second->abstract && entry.second->importLevel == 0)
-                        {
-                            writeDataReaderClassContent(os, entry.second, profile);
-                        }
-                    }
-                }
-                else if (blockName == "includes")
+                // classes
+                for (std::pair<String,Data*> entry : m_data)
                 {
-                    // include
-                    for (const String &header : m_includes[T_COMMON][F_HPP])
-                    {
-                        os->writeLine(String("#include ") + header);
-                    }
-
-                    for (const String &header : m_includes[m_currentType][F_HPP])
+                    if (!entry.second->abstract && entry.second->importLevel == 0)
                     {
-                        os->writeLine(String("#include ") + header);
+                        writeDataReaderClassContent(&buffer, entry.second, profile);
                     }
                 }
             }
-            else
+            else if (blockName == "includes")
             {
-                // line with 0 or many variables
-                parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
-                os->writeLine(outLine);
+                // include
+                for (const String &header : m_includes[T_COMMON][F_HPP])
+                {
+                    buffer.writeLine(String("#include ") + header);
+                }
+
+                for (const String &header : m_includes[getTarget(profile)][F_HPP])
+                {
+                    buffer.writeLine(String("#include ") + header);
+                }
+
+                // DataStringView, DataFixedString
+                if (m_encodedTypes)
+                    buffer.writeLine("#include \"" + getRuntimeHeader("DataEncoding", profile) + "\"");
             }
         }
-    } catch (E_BaseException &e)
-    {
-        deletePtr(os);
-        throw;
+        else
+        {
+            // line with 0 or many variables
+            parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
+            buffer.writeLine(outLine);
+        }
     }
 
-    deletePtr(os);
+    writeOutput(filename, std::move(buffer), profile);
+
+    if (m_generator.isFanOutReport())
+        m_generator.registerHeader(profile, getHeaderFanOut(filename, profile));
 }
 
-void DataFile::writeDataReaderImpl(const String &outPath, const String &cppExt, Profile profile)
+void DataFile::writeDataReaderImpl(const String &outPath, const String &cppExt, Profile profile, Bool templates) const
 {
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::writeDataReaderImpl", m_filename, Stats::PHASE_NONE);
+
     // only if concrete message to export
     Bool something = False;
     for (std::pair<String, Data*> entry : m_data)
     {
-        if (!entry.second->abstract && entry.second->importLevel == 0)
+        if (isImplemented(entry.second, templates))
         {
             something = True;
             break;
@@ -1038,130 +1163,136 @@ void DataFile::writeDataReaderImpl(const String &outPath, const String &cppExt,
     }
 
     if (!something)
+    {
+        stats.addFileSkipped(m_filename);
         return;
+    }
 
-    LocalDir dir(outPath + "/" + m_pathname);
-    if (!dir.exists())
+    // templates implementations are only included by the explicit instantiations
+    String ext = templates ? "inl" : cppExt;
+    String filename = getOutFileName(outPath, m_prefix + "Data." + ext);
+
+    TextBuffer buffer;
+
+    for (const String &cppLine : m_generator.getTemplate(Generator::TPL_CPP))
     {
-        dir.cdUp();
-        dir.makeDir(m_pathname);
-    }
+        String outLine = cppLine;
+        Int32 p1;
+        Int32 p2;
 
-    String filename = FileManager::instance()->getFullFileName(outPath + "/" + m_pathname + "/" + m_prefix + "Data." + cppExt);
-    FileOutStream *os = FileManager::instance()->openOutStream(filename, FileOutStream::CREATE);
+        if (outLine.isEmpty())
+            buffer.writeLine("");
 
-    try {
-        for (const String &cppLine : Main::instance()->getTemplate(Main::TPL_CPP))
+        // block
+        else if ((p1 = outLine.sub("@{", 0)) != -1)
         {
-            String outLine = cppLine;
-            Int32 p1;
-            Int32 p2;
-
-            if (outLine.isEmpty())
-                os->writeLine("");
+            p1 = 0;
+            p2 = outLine.find('}', p1+2);
 
-            // block
-            else if ((p1 = outLine.sub("@{", 0)) != -1)
+            if (p2 == -1)
             {
-                p1 = 0;
-                p2 = outLine.find('}', p1+2);
+                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in cpp.template"));
+            }
 
-                if (p2 == -1)
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "license")
+            {
+                // license
+                for (const String &line : m_generator.getTemplate(Generator::TPL_LICENCE))
                 {
-                    deletePtr(os);
-                    O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in cpp.template"));
+                    buffer.writeLine(line);
                 }
-
-                String blockName = outLine.sub(p1+2, p2);
-                if (blockName == "license")
+            }
+            else if (blockName == "content")
+            {
+                for (std::pair<String,Data*> entry : m_data)
                 {
-                    // license
-                    for (const String &line : Main::instance()->getTemplate(Main::TPL_LICENCE))
+                    if (isImplemented(entry.second, templates))
                     {
-                        os->writeLine(line);
+                        writeDataReaderImplContent(&buffer, entry.second, profile);
                     }
                 }
-                else if (blockName == "content")
+            }
+            else if (blockName == "includes")
+            {
+                // include
+                String includes = m_generator.getIncludePath(profile);
+
+                if (includes.isValid())
                 {
-                    for (std::pair<String,Data*> entry : m_data)
+                    for (const String &header : m_includes[T_COMMON][F_CPP])
                     {
-                        if (!entry.second->abstract && entry.second->importLevel == 0)
+                        if (header.startsWith("\""))
                         {
-                            writeDataReaderImplContent(os, entry.second, profile);
+                            String h = header;
+                            h.trimLeft('"');
+
+                            buffer.writeLine(String("#include ") + "\"" + includes + "/" + h);
                         }
+                        else
+                            buffer.writeLine(String("#include ") + includes + "/" + header);
                     }
-                }
-                else if (blockName == "includes")
-                {
-                    // include
-                    String includes = Main::instance()->getIncludePath(profile);
 
-                    if (includes.isValid())
+                    for (const String &header : m_includes[getTarget(profile)][F_CPP])
                     {
-                        for (const String &header : m_includes[T_COMMON][F_CPP])
+                        if (header.startsWith("\""))
                         {
-                            if (header.startsWith("\""))
-                            {
-                                String h = header;
-                                h.trimLeft('"');
-
-                                os->writeLine(String("#include ") + "\"" + includes + "/" + h);
-                            }
-                            else
-                                os->writeLine(String("#include ") + includes + "/" + header);
-                        }
+                            String h = header;
+                            h.trimLeft('"');
+                            h.remove("../");
 
-                        for (const String &header : m_includes[m_currentType][F_CPP])
-                        {
-                            if (header.startsWith("\""))
-                            {
-                                String h = header;
-                                h.trimLeft('"');
-                                h.remove("../");
-
-                                os->writeLine(String("#include ") + "\"" + includes + "/" + h);
-                            }
-                            else
-                                os->writeLine(String("#include ") + includes + "/" + header);
+                            buffer.writeLine(String("#include ") + "\"" + includes + "/" + h);
                         }
+                        else
+                            buffer.writeLine(String("#include ") + includes + "/" + header);
                     }
-                    else
+                }
+                else
+                {
+                    for (const String &header : m_includes[T_COMMON][F_CPP])
                     {
-                        for (const String &header : m_includes[T_COMMON][F_CPP])
-                        {
-                            os->writeLine(String("#include ") + header);
-                        }
+                        buffer.writeLine(String("#include ") + header);
+                    }
 
-                        for (const String &header : m_includes[m_currentType][F_CPP])
-                        {
-                            os->writeLine(String("#include ") + header);
-                        }
+                    for (const String &header : m_includes[getTarget(profile)][F_CPP])
+                    {
+                        buffer.writeLine(String("#include ") + header);
                     }
                 }
-            }
-            else
-            {
-                // line with 0 or many variables
-                parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
-                os->writeLine(outLine);
+
+                // variable length integers
+                if (m_encoded)
+                    buffer.writeLine("#include \"" + getRuntimeHeader("DataEncoding", profile) + "\"");
             }
         }
-    } catch (E_BaseException &e)
-    {
-        deletePtr(os);
-        throw;
+        else
+        {
+            // line with 0 or many variables
+            parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
+            buffer.writeLine(outLine);
+        }
     }
 
-    deletePtr(os);
+    UInt64 size = buffer.getSize();
+    writeOutput(filename, std::move(buffer), profile);
+
+    // for the unity files, or the explicit instantiations
+    if (templates)
+        registerTemplateFile(profile, m_prefix + "Data." + ext);
+    else
+        m_generator.registerSource(profile, m_pathname, m_prefix + "Data." + ext, size);
 }
 
-void DataFile::writeDataReaderUserImpl(const String &outPath, const String &cppExt, Profile profile)
+void DataFile::writeDataReaderUserImpl(const String &outPath, const String &cppExt, Profile profile, Bool templates) const
 {
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::writeDataReaderUserImpl", m_filename, Stats::PHASE_NONE);
+
     // only if concrete message to export
     Bool something = False;
     for (std::pair<String, Data*> entry : m_data)
     {
-        if (!entry.second->abstract && entry.second->importLevel == 0)
+        if (isImplemented(entry.second, templates))
         {
             something = True;
             break;
@@ -1169,133 +1300,143 @@ void DataFile::writeDataReaderUserImpl(const String &outPath, const String &cppE
     }
 
     if (!something)
+    {
+        stats.addFileSkipped(m_filename);
         return;
+    }
+
+    // templates implementations are only included by the explicit instantiations
+    String ext = templates ? "inl" : cppExt;
+    String filename = getOutFileName(outPath, m_prefix + "Data.user." + ext);
 
-    LocalDir dir(outPath + "/" + m_pathname);
-    if (!dir.exists())
+    // never overwrite the user implementation
+    if (m_generator.getOutputSink().exists(filename))
     {
-        dir.cdUp();
-        dir.makeDir(m_pathname);
-    }
+        stats.addFileSkipped(m_filename);
 
-    String filename = FileManager::instance()->getFullFileName(outPath + "/" + m_pathname + "/" + m_prefix + "Data.user." + cppExt);
+        if (templates)
+            registerTemplateFile(profile, m_prefix + "Data.user." + ext);
+        else
+            m_generator.registerSource(profile, m_pathname, m_prefix + "Data.user." + ext, 0);
 
-    LocalFile fileInfo(filename);
-    if (fileInfo.exists())
         return;
+    }
 
-    FileOutStream *os = FileManager::instance()->openOutStream(filename, FileOutStream::CREATE);
+    TextBuffer buffer;
 
-    try {
-        for (const String &cppLine : Main::instance()->getTemplate(Main::TPL_CPP))
-        {
-            String outLine = cppLine;
-            Int32 p1;
-            Int32 p2;
+    for (const String &cppLine : m_generator.getTemplate(Generator::TPL_CPP))
+    {
+        String outLine = cppLine;
+        Int32 p1;
+        Int32 p2;
+
+        if (outLine.isEmpty())
+            buffer.writeLine("");
 
-            if (outLine.isEmpty())
-                os->writeLine("");
+        // block
+        else if ((p1 = outLine.sub("@{", 0)) != -1)
+        {
+            p1 = 0;
+            p2 = outLine.find('}', p1+2);
 
-            // block
-            else if ((p1 = outLine.sub("@{", 0)) != -1)
+            if (p2 == -1)
             {
-                p1 = 0;
-                p2 = outLine.find('}', p1+2);
+                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in cpp.template"));
+            }
 
-                if (p2 == -1)
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "license")
+            {
+                // license
+                for (const String &line : m_generator.getTemplate(Generator::TPL_LICENCE))
                 {
-                    deletePtr(os);
-                    O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in cpp.template"));
+                    buffer.writeLine(line);
                 }
-
-                String blockName = outLine.sub(p1+2, p2);
-                if (blockName == "license")
+            }
+            else if (blockName == "content")
+            {
+                for (std::pair<String,Data*> entry : m_data)
                 {
-                    // license
-                    for (const String &line : Main::instance()->getTemplate(Main::TPL_LICENCE))
+                    if (isImplemented(entry.second, templates))
                     {
-                        os->writeLine(line);
+                        writeDataReaderUserImplContent(&buffer, entry.second, profile);
                     }
                 }
-                else if (blockName == "content")
+            }
+            else if (blockName == "includes")
+            {
+                // include
+                String includes = m_generator.getIncludePath(profile);
+
+                if (includes.isValid())
                 {
-                    for (std::pair<String,Data*> entry : m_data)
+                    for (const String &header : m_includes[T_COMMON][F_CPP])
                     {
-                        if (!entry.second->abstract && entry.second->importLevel == 0)
+                        if (header.startsWith("\""))
                         {
-                            writeDataReaderUserImplContent(os, entry.second, profile);
+                            String h = header;
+                            h.trimLeft('"');
+
+                            buffer.writeLine(String("#include ") + "\"" + includes + "/" + h);
                         }
+                        else
+                            buffer.writeLine(String("#include ") + includes + "/" + header);
                     }
-                }
-                else if (blockName == "includes")
-                {
-                    // include
-                    String includes = Main::instance()->getIncludePath(profile);
 
-                    if (includes.isValid())
+                    for (const String &header : m_includes[getTarget(profile)][F_CPP])
                     {
-                        for (const String &header : m_includes[T_COMMON][F_CPP])
+                        if (header.startsWith("\""))
                         {
-                            if (header.startsWith("\""))
-                            {
-                                String h = header;
-                                h.trimLeft('"');
-
-                                os->writeLine(String("#include ") + "\"" + includes + "/" + h);
-                            }
-                            else
-                                os->writeLine(String("#include ") + includes + "/" + header);
-                        }
+                            String h = header;
+                            h.trimLeft('"');
+                            h.remove("../");
 
-                        for (const String &header : m_includes[m_currentType][F_CPP])
-                        {
-                            if (header.startsWith("\""))
-                            {
-                                String h = header;
-                                h.trimLeft('"');
-                                h.remove("../");
-
-                                os->writeLine(String("#include ") + "\"" + includes + "/" + h);
-                            }
-                            else
-                                os->writeLine(String("#include ") + includes + "/" + header);
+                            buffer.writeLine(String("#include ") + "\"" + includes + "/" + h);
                         }
+                        else
+                            buffer.writeLine(String("#include ") + includes + "/" + header);
                     }
-                    else
+                }
+                else
+                {
+                    for (const String &header : m_includes[T_COMMON][F_CPP])
                     {
-                        for (const String &header : m_includes[T_COMMON][F_CPP])
-                        {
-                            os->writeLine(String("#include ") + header);
-                        }
+                        buffer.writeLine(String("#include ") + header);
+                    }
 
-                        for (const String &header : m_includes[m_currentType][F_CPP])
-                        {
-                            os->writeLine(String("#include ") + header);
-                        }
+                    for (const String &header : m_includes[getTarget(profile)][F_CPP])
+                    {
+                        buffer.writeLine(String("#include ") + header);
                     }
                 }
             }
-            else
-            {
-                // line with 0 or many variables
-                parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
-                os->writeLine(outLine);
-            }
         }
-    } catch (E_BaseException &e)
-    {
-        deletePtr(os);
-        throw;
+        else
+        {
+            // line with 0 or many variables
+            parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
+            buffer.writeLine(outLine);
+        }
     }
 
-    deletePtr(os);
+    UInt64 size = buffer.getSize();
+    writeOutput(filename, std::move(buffer), profile);
+
+    // for the unity files, or the explicit instantiations
+    if (templates)
+        registerTemplateFile(profile, m_prefix + "Data.user." + ext);
+    else
+        m_generator.registerSource(profile, m_pathname, m_prefix + "Data.user." + ext, size);
 }
 
-void DataFile::writeDataReaderClassContent(OutStream *os, Data *data, Profile profile)
+void DataFile::writeDataReaderClassContent(TextBuffer *os, Data *data, Profile profile) const
 {
     TargetType targetType = TargetType(profile + 1);
 
-    for (const String &inClassLine : Main::instance()->getTemplate(Main::TPL_DATA_READER_CLASS))
+    // the string views point into the buffer of a memory stream
+    const String inStream = isViewed(data, profile) ? "DataMemoryInStream" : "o3d::InStream";
+
+    for (const String &inClassLine : m_generator.getTemplate(Generator::TPL_DATA_READER_CLASS))
     {
         String outLine = inClassLine;
         Int32 p1;
@@ -1311,7 +1452,6 @@ void DataFile::writeDataReaderClassContent(OutStream *os, Data *data, Profile pr
 
             if (p2 == -1)
             {
-                deletePtr(os);
                 O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in msg.in.class.template"));
             }
 
@@ -1320,11 +1460,23 @@ void DataFile::writeDataReaderClassContent(OutStream *os, Data *data, Profile pr
             {
                 for (Member *member : data->initializers)
                 {
-                    // write only if resolved
+                    // write only if resolved, or if a template argument of a class template
                     if (!member->getValue().startsWith("<"))
                         os->writeLine("        " + member->getPrefixedName() + " = " + member->getValue() + ";");
+                    else if (isExplicitTemplate(data))
+                    {
+                        String arg = member->getValue();
+                        arg.trimLeft('<');
+                        arg.trimRight('>');
+
+                        os->writeLine("        " + member->getPrefixedName() + " = " + arg + ";");
+                    }
                 }
             }
+            else if (blockName == "template")
+            {
+                writeTemplateDecl(os, data, profile, True);
+            }
             else if (blockName == "private_members")
             {
                 for (Member *member : data->members[T_COMMON])
@@ -1362,6 +1514,60 @@ void DataFile::writeDataReaderClassContent(OutStream *os, Data *data, Profile pr
                     member->writeGetterDecl(os);
                 }
             }
+            else if (blockName == "strings")
+            {
+                // pack.strings = true
+                if (m_generator.isPackStrings())
+                {
+                    os->writeLine("    //! Read the strings as indices into strings, or as themselves if null.");
+                    os->writeLine("    virtual o3d::Bool readFromFile(" + inStream +
+                                  " &is, const DataStringTable *strings);");
+                }
+            }
+            else if (blockName == "arena")
+            {
+                // arena = true
+                if (m_generator.isArena())
+                {
+                    os->writeLine("    //! Read with the loops and the custom arrays allocated from an arena.");
+                    os->writeLine("    o3d::Bool readFromFile(" + inStream + " &is, DataArena &arena)");
+                    os->writeLine("    {");
+                    os->writeLine("        DataArenaScope scope(arena);");
+                    os->writeLine("        return readFromFile(is);");
+                    os->writeLine("    }");
+                }
+            }
+            else if (blockName == "pool")
+            {
+                // pool = true
+                if (m_generator.isPool())
+                    os->writeLine("    typedef DataPool<" + data->name + "Data> Pool;");
+            }
+            else if (blockName == "views")
+            {
+                // the base is read from any stream, its read is hidden and throws
+                // if called through the base class
+                if (data->directInherit && inStream != "o3d::InStream" &&
+                    !isViewed(data->directInherit, profile))
+                {
+                    os->writeLine("    //! The string views are read from a DataMemoryInStream only.");
+                    os->writeLine("    virtual o3d::Bool readFromFile(o3d::InStream &is)");
+                    os->writeLine("    {");
+                    os->writeLine("        O3D_ERROR(o3d::E_InvalidOperation(\"" + data->name +
+                                  " must be read from a DataMemoryInStream\"));");
+                    os->writeLine("    }");
+
+                    if (m_generator.isPackStrings())
+                    {
+                        os->writeLine("");
+                        os->writeLine("    virtual o3d::Bool readFromFile(o3d::InStream &is, const DataStringTable *strings)");
+                        os->writeLine("    {");
+                        os->writeLine("        O3D_ERROR(o3d::E_InvalidOperation(\"" + data->name +
+                                      " must be read from a DataMemoryInStream\"));");
+                        os->writeLine("    }");
+                    }
+                }
+            }
         }
         else
         {
@@ -1374,15 +1580,15 @@ void DataFile::writeDataReaderClassContent(OutStream *os, Data *data, Profile pr
     os->writeLine("");
 }
 
-void DataFile::writeDataReaderImplContent(OutStream *os, Data *data, Profile profile)
+void DataFile::writeDataReaderImplContent(TextBuffer *os, Data *data, Profile profile) const
 {
     Context ctx;
     ctx.data = data;
     ctx.os = os;
     ctx.profile = profile;
-    ctx.target = m_currentType;
+    ctx.target = getTarget(profile);
 
-    for (const String &inImplLine : Main::instance()->getTemplate(Main::TPL_DATA_READER_IMPL))
+    for (const String &inImplLine : m_generator.getTemplate(Generator::TPL_DATA_READER_IMPL))
     {
         String outLine = inImplLine;
         Int32 p1;
@@ -1398,30 +1604,40 @@ void DataFile::writeDataReaderImplContent(OutStream *os, Data *data, Profile pro
 
             if (p2 == -1)
             {
-                deletePtr(os);
                 O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in msg.in.class.template"));
             }
 
             String blockName = outLine.sub(p1+2, p2);
             if (blockName == "readFromFile")
             {
-                // inherited class
-                if (data->directInherit)
+                // pack.strings = true, the members are read by the overload with a table
+                if (m_generator.isPackStrings())
+                    os->writeLine("    " + getDataClass(data) + "::readFromFile(is, nullptr);");
+                else
+                    writeReadMembers(os, data, profile);
+            }
+            else if (blockName == "readFromFileStrings")
+            {
+                if (m_generator.isPackStrings())
                 {
-                    String line = "    " + data->directInherit->name + m_suffix + "::readFromFile(is);";
-                    os->writeLine(line);
+                    writeTemplateDecl(os, data, profile, False);
+                    os->writeLine("o3d::Bool " + getDataClass(data) + "::readFromFile(" +
+                                  (isViewed(data, profile) ? String("DataMemoryInStream") : String("o3d::InStream")) +
+                                  " &is, const DataStringTable *strings)");
+                    os->writeLine("{");
+                    writeReadMembers(os, data, profile);
                     os->writeLine("");
+                    os->writeLine("    return True;");
+                    os->writeLine("}");
                 }
-
-                for (Member *member : data->members[T_COMMON])
-                {
-                    member->writeRead(os);
-                }
-
-                for (Member *member : data->members[m_currentType])
-                {
-                    member->writeRead(os);
-                }
+            }
+            else if (blockName == "readBatch")
+            {
+                writeBatchRead(os, data, profile);
+            }
+            else if (blockName == "reset")
+            {
+                writeReset(os, data, profile);
             }
             else if (blockName == "finalize")
             {
@@ -1430,6 +1646,10 @@ void DataFile::writeDataReaderImplContent(OutStream *os, Data *data, Profile pro
                     member->writeFinalize(ctx);
                 }
             }
+            else if (blockName == "template")
+            {
+                writeTemplateDecl(os, data, profile, False);
+            }
         }
         else
         {
@@ -1442,9 +1662,9 @@ void DataFile::writeDataReaderImplContent(OutStream *os, Data *data, Profile pro
     os->writeLine("");
 }
 
-void DataFile::writeDataReaderUserImplContent(OutStream *os, Data *data, Profile profile)
+void DataFile::writeDataReaderUserImplContent(TextBuffer *os, Data *data, Profile profile) const
 {
-    for (const String &inImplLine : Main::instance()->getTemplate(Main::TPL_DATA_READER_USER_IMPL))
+    for (const String &inImplLine : m_generator.getTemplate(Generator::TPL_DATA_READER_USER_IMPL))
     {
         String outLine = inImplLine;
         Int32 p1;
@@ -1460,11 +1680,14 @@ void DataFile::writeDataReaderUserImplContent(OutStream *os, Data *data, Profile
 
             if (p2 == -1)
             {
-                deletePtr(os);
                 O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in msg.in.class.template"));
             }
 
-            //String blockName = outLine.sub(p1+2, p2);
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "template")
+            {
+                writeTemplateDecl(os, data, profile, False);
+            }
         }
         else
         {
@@ -1477,8 +1700,11 @@ void DataFile::writeDataReaderUserImplContent(OutStream *os, Data *data, Profile
     os->writeLine("");
 }
 
-void DataFile::writeDataWriterClass(const String &outPath, const String &hppExt, DataFile::Profile profile)
+void DataFile::writeDataWriterClass(const String &outPath, const String &hppExt, DataFile::Profile profile) const
 {
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::writeDataWriterClass", m_filename, Stats::PHASE_NONE);
+
     // only if concrete message to export
     Bool something = False;
     for (std::pair<String, Data*> entry : m_data)
@@ -1491,106 +1717,106 @@ void DataFile::writeDataWriterClass(const String &outPath, const String &hppExt,
     }
 
     if (!something)
+    {
+        stats.addFileSkipped(m_filename);
         return;
+    }
+
+    String filename = getOutFileName(outPath, m_prefix + "Data." + hppExt);
+
+    TextBuffer buffer;
 
-    LocalDir dir(outPath + "/" + m_pathname);
-    if (!dir.exists())
+    for (const String &hppLine : m_generator.getTemplate(Generator::TPL_HPP))
     {
-        dir.cdUp();
-        dir.makeDir(m_pathname);
-    }
+        String outLine = hppLine;
+        Int32 p1;
+        Int32 p2;
 
-    String filename = FileManager::instance()->getFullFileName(outPath + "/" + m_pathname + "/" + m_prefix + "Data." + hppExt);
-    FileOutStream *os = FileManager::instance()->openOutStream(filename, FileOutStream::CREATE);
+        if (outLine.isEmpty())
+            buffer.writeLine("");
 
-    try {
-        for (const String &hppLine : Main::instance()->getTemplate(Main::TPL_HPP))
+        // block
+        else if ((p1 = outLine.sub("@{", 0)) != -1)
         {
-            String outLine = hppLine;
-            Int32 p1;
-            Int32 p2;
-
-            if (outLine.isEmpty())
-                os->writeLine("");
+            p1 = 0;
+            p2 = outLine.find('}', p1+2);
 
-            // block
-            else if ((p1 = outLine.sub("@{", 0)) != -1)
+            if (p2 == -1)
             {
-                p1 = 0;
-                p2 = outLine.find('}', p1+2);
+                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in hpp.template"));
+            }
 
-                if (p2 == -1)
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "license")
+            {
+                // license
+                for (const String &line : m_generator.getTemplate(Generator::TPL_LICENCE))
                 {
-                    deletePtr(os);
-                    O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in hpp.template"));
+                    buffer.writeLine(line);
                 }
-
-                String blockName = outLine.sub(p1+2, p2);
-                if (blockName == "license")
+            }
+            else if (blockName == "content")
+            {
+                // classes predeclarations
+                for (const String &clazz : m_preClass)
                 {
-                    // license
-                    for (const String &line : Main::instance()->getTemplate(Main::TPL_LICENCE))
-                    {
-                        os->writeLine(line);
-                    }
+                    buffer.writeLine("class " + clazz + ";");
                 }
-                else if (blockName == "content")
-                {
-                    // classes predeclarations
-                    for (String &clazz : m_preClass)
-                    {
-                        os->writeLine("class " + clazz + ";");
-                    }
 
-                    if (m_preClass.size())
-                        os->writeLine("");
+                if (m_preClass.size())
+                    buffer.writeLine("");
 
-                    // classes declarations
-                    for (std::pair<String,Data*> entry : m_data)
-                    {
-                        if (!entry.second->abstract && entry.second->importLevel == 0)
-                        {
-                            writeDataWriterClassContent(os, entry.second, profile);
-                        }
-                    }
-                }
-                else if (blockName == "includes")
+                // classes declarations
+                for (std::pair<String,Data*> entry : m_data)
                 {
-                    // include
-                    for (const String &header : m_includes[T_COMMON][F_CPP])
+                    if (!entry.second->abstract && entry.second->importLevel == 0)
                     {
-                        os->writeLine(String("#include ") + header);
-                    }
-
-                    for (const String &header : m_includes[m_currentType][F_CPP])
-                    {
-                        os->writeLine(String("#include ") + header);
+                        writeDataWriterClassContent(&buffer, entry.second, profile);
                     }
                 }
             }
-            else
+            else if (blockName == "includes")
             {
-                // line with 0 or many variables
-                parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
-                os->writeLine(outLine);
+                // include
+                for (const String &header : m_includes[T_COMMON][F_HPP])
+                {
+                    buffer.writeLine(String("#include ") + header);
+                }
+
+                for (const String &header : m_includes[getTarget(profile)][F_HPP])
+                {
+                    buffer.writeLine(String("#include ") + header);
+                }
+
+                // DataStringView, DataFixedString
+                if (m_encodedTypes)
+                    buffer.writeLine("#include \"" + getRuntimeHeader("DataEncoding", profile) + "\"");
             }
         }
-    } catch (E_BaseException &e)
-    {
-        deletePtr(os);
-        throw;
+        else
+        {
+            // line with 0 or many variables
+            parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
+            buffer.writeLine(outLine);
+        }
     }
 
-    deletePtr(os);
+    writeOutput(filename, std::move(buffer), profile);
+
+    if (m_generator.isFanOutReport())
+        m_generator.registerHeader(profile, getHeaderFanOut(filename, profile));
 }
 
-void DataFile::writeDataWriterImpl(const String &outPath, const String &cppExt, DataFile::Profile profile)
+void DataFile::writeDataWriterImpl(const String &outPath, const String &cppExt, DataFile::Profile profile, Bool templates) const
 {
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::writeDataWriterImpl", m_filename, Stats::PHASE_NONE);
+
     // only if concrete message to export
     Bool something = False;
     for (std::pair<String, Data*> entry : m_data)
     {
-        if (!entry.second->abstract && entry.second->importLevel == 0)
+        if (isImplemented(entry.second, templates))
         {
             something = True;
             break;
@@ -1598,128 +1824,131 @@ void DataFile::writeDataWriterImpl(const String &outPath, const String &cppExt,
     }
 
     if (!something)
+    {
+        stats.addFileSkipped(m_filename);
         return;
+    }
+
+    // templates implementations are only included by the explicit instantiations
+    String ext = templates ? "inl" : cppExt;
+    String filename = getOutFileName(outPath, m_prefix + "Data." + ext);
+
+    TextBuffer buffer;
 
-    LocalDir dir(outPath + "/" + m_pathname);
-    if (!dir.exists())
+    for (const String &cppLine : m_generator.getTemplate(Generator::TPL_CPP))
     {
-        dir.cdUp();
-        dir.makeDir(m_pathname);
-    }
+        String outLine = cppLine;
+        Int32 p1;
+        Int32 p2;
 
-    String filename = FileManager::instance()->getFullFileName(outPath + "/" + m_pathname + "/" + m_prefix + "Data." + cppExt);
-    FileOutStream *os = FileManager::instance()->openOutStream(filename, FileOutStream::CREATE);
+        if (outLine.isEmpty())
+            buffer.writeLine("");
 
-    try {
-        for (const String &cppLine : Main::instance()->getTemplate(Main::TPL_CPP))
+        // block
+        else if ((p1 = outLine.sub("@{", 0)) != -1)
         {
-            String outLine = cppLine;
-            Int32 p1;
-            Int32 p2;
-
-            if (outLine.isEmpty())
-                os->writeLine("");
+            p1 = 0;
+            p2 = outLine.find('}', p1+2);
 
-            // block
-            else if ((p1 = outLine.sub("@{", 0)) != -1)
+            if (p2 == -1)
             {
-                p1 = 0;
-                p2 = outLine.find('}', p1+2);
+                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in cpp.template"));
+            }
 
-                if (p2 == -1)
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "license")
+            {
+                // license
+                for (const String &line : m_generator.getTemplate(Generator::TPL_LICENCE))
                 {
-                    deletePtr(os);
-                    O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in cpp.template"));
+                    buffer.writeLine(line);
                 }
-
-                String blockName = outLine.sub(p1+2, p2);
-                if (blockName == "license")
+            }
+            else if (blockName == "content")
+            {
+                for (std::pair<String,Data*> entry : m_data)
                 {
-                    // license
-                    for (const String &line : Main::instance()->getTemplate(Main::TPL_LICENCE))
+                    if (isImplemented(entry.second, templates))
                     {
-                        os->writeLine(line);
+                        writeDataWriterImplContent(&buffer, entry.second, profile);
                     }
                 }
-                else if (blockName == "content")
+            }
+            else if (blockName == "includes")
+            {
+                // include
+                String includes = m_generator.getIncludePath(profile);
+
+                if (includes.isValid())
                 {
-                    for (std::pair<String,Data*> entry : m_data)
+                    for (const String &header : m_includes[T_COMMON][F_CPP])
                     {
-                        if (!entry.second->abstract && entry.second->importLevel == 0)
+                        if (header.startsWith("\""))
                         {
-                            writeDataWriterImplContent(os, entry.second, profile);
+                            String h = header;
+                            h.trimLeft('"');
+
+                            buffer.writeLine(String("#include ") + "\"" + includes + "/" + h);
                         }
+                        else
+                            buffer.writeLine(String("#include ") + includes + "/" + header);
                     }
-                }
-                else if (blockName == "includes")
-                {
-                    // include
-                    String includes = Main::instance()->getIncludePath(profile);
 
-                    if (includes.isValid())
+                    for (const String &header : m_includes[getTarget(profile)][F_CPP])
                     {
-                        for (const String &header : m_includes[T_COMMON][F_CPP])
+                        if (header.startsWith("\""))
                         {
-                            if (header.startsWith("\""))
-                            {
-                                String h = header;
-                                h.trimLeft('"');
-
-                                os->writeLine(String("#include ") + "\"" + includes + "/" + h);
-                            }
-                            else
-                                os->writeLine(String("#include ") + includes + "/" + header);
-                        }
+                            String h = header;
+                            h.trimLeft('"');
+                            h.remove("../");
 
-                        for (const String &header : m_includes[m_currentType][F_CPP])
-                        {
-                            if (header.startsWith("\""))
-                            {
-                                String h = header;
-                                h.trimLeft('"');
-                                h.remove("../");
-
-                                os->writeLine(String("#include ") + "\"" + includes + "/" + h);
-                            }
-                            else
-                                os->writeLine(String("#include ") + includes + "/" + header);
+                            buffer.writeLine(String("#include ") + "\"" + includes + "/" + h);
                         }
+                        else
+                            buffer.writeLine(String("#include ") + includes + "/" + header);
                     }
-                    else
+                }
+                else
+                {
+                    for (const String &header : m_includes[T_COMMON][F_CPP])
                     {
-                        for (const String &header : m_includes[T_COMMON][F_CPP])
-                        {
-                            os->writeLine(String("#include ") + header);
-                        }
+                        buffer.writeLine(String("#include ") + header);
+                    }
 
-                        for (const String &header : m_includes[m_currentType][F_CPP])
-                        {
-                            os->writeLine(String("#include ") + header);
-                        }
+                    for (const String &header : m_includes[getTarget(profile)][F_CPP])
+                    {
+                        buffer.writeLine(String("#include ") + header);
                     }
                 }
-            }
-            else
-            {
-                // line with 0 or many variables
-                parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
-                os->writeLine(outLine);
+
+                // variable length integers
+                if (m_encoded)
+                    buffer.writeLine("#include \"" + getRuntimeHeader("DataEncoding", profile) + "\"");
             }
         }
-    } catch (E_BaseException &e)
-    {
-        deletePtr(os);
-        throw;
+        else
+        {
+            // line with 0 or many variables
+            parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
+            buffer.writeLine(outLine);
+        }
     }
 
-    deletePtr(os);
+    UInt64 size = buffer.getSize();
+    writeOutput(filename, std::move(buffer), profile);
+
+    // for the unity files, or the explicit instantiations
+    if (templates)
+        registerTemplateFile(profile, m_prefix + "Data." + ext);
+    else
+        m_generator.registerSource(profile, m_pathname, m_prefix + "Data." + ext, size);
 }
 
-void DataFile::writeDataWriterClassContent(OutStream *os, Data *data, DataFile::Profile profile)
+void DataFile::writeDataWriterClassContent(TextBuffer *os, Data *data, DataFile::Profile profile) const
 {
     TargetType targetType = TargetType(profile + 1);
 
-    for (const String &outClassLine : Main::instance()->getTemplate(Main::TPL_DATA_WRITER_CLASS))
+    for (const String &outClassLine : m_generator.getTemplate(Generator::TPL_DATA_WRITER_CLASS))
     {
         String outLine = outClassLine;
         Int32 p1;
@@ -1735,7 +1964,6 @@ void DataFile::writeDataWriterClassContent(OutStream *os, Data *data, DataFile::
 
             if (p2 == -1)
             {
-                deletePtr(os);
                 O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in msg.in.class.template"));
             }
 
@@ -1745,11 +1973,23 @@ void DataFile::writeDataWriterClassContent(OutStream *os, Data *data, DataFile::
                 // resolve initializers
                 for (Member *member : data->initializers)
                 {
-                    // write only if resolved
+                    // write only if resolved, or if a template argument of a class template
                     if (!member->getValue().startsWith("<"))
                         os->writeLine("        " + member->getPrefixedName() + " = " + member->getValue() + ";");
+                    else if (isExplicitTemplate(data))
+                    {
+                        String arg = member->getValue();
+                        arg.trimLeft('<');
+                        arg.trimRight('>');
+
+                        os->writeLine("        " + member->getPrefixedName() + " = " + arg + ";");
+                    }
                 }
             }
+            else if (blockName == "template")
+            {
+                writeTemplateDecl(os, data, profile, True);
+            }
             else if (blockName == "private_members")
             {
                 for (Member *member : data->members[T_COMMON])
@@ -1776,6 +2016,15 @@ void DataFile::writeDataWriterClassContent(OutStream *os, Data *data, DataFile::
                         member->writeDecl(os);
                 }
             }
+            else if (blockName == "strings")
+            {
+                // pack.strings = true
+                if (m_generator.isPackStrings())
+                {
+                    os->writeLine("    //! Write the strings as indices into strings, or as themselves if null.");
+                    os->writeLine("    virtual o3d::Bool writeToFile(o3d::OutStream &os, DataStringTable *strings) const;");
+                }
+            }
             else if (blockName == "setters")
             {
                 for (Member *member : data->members[T_COMMON])
@@ -1801,182 +2050,891 @@ void DataFile::writeDataWriterClassContent(OutStream *os, Data *data, DataFile::
         }
         else
         {
-            // line with 0 or many variables
-            parseVariable(outLine, data, m_prefix + m_suffix, m_suffix, profile);
-            os->writeLine(outLine);
+            // line with 0 or many variables
+            parseVariable(outLine, data, m_prefix + m_suffix, m_suffix, profile);
+            os->writeLine(outLine);
+        }
+    }
+
+    os->writeLine("");
+}
+
+void DataFile::writeDataWriterImplContent(TextBuffer *os, Data *data, DataFile::Profile profile) const
+{
+    for (const String &outImplLine : m_generator.getTemplate(Generator::TPL_DATA_WRITER_IMPL))
+    {
+        String outLine = outImplLine;
+        Int32 p1;
+        Int32 p2;
+
+        if (outLine.isEmpty())
+            os->writeLine("");
+
+        // block
+        else if ((p1 = outLine.sub("@{", 0)) != -1)
+        {
+            p2 = outLine.find('}', p1+2);
+
+            if (p2 == -1)
+            {
+                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in msg.out.impl.template"));
+            }
+
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "writeToFile")
+            {
+                // pack.strings = true, the members are written by the overload with a table
+                if (m_generator.isPackStrings())
+                    os->writeLine("    " + getDataClass(data) + "::writeToFile(os, nullptr);");
+                else
+                    writeWriteMembers(os, data, profile);
+            }
+            else if (blockName == "writeToFileStrings")
+            {
+                if (m_generator.isPackStrings())
+                {
+                    writeTemplateDecl(os, data, profile, False);
+                    os->writeLine("o3d::Bool " + getDataClass(data) +
+                                  "::writeToFile(o3d::OutStream &os, DataStringTable *strings) const");
+                    os->writeLine("{");
+                    writeWriteMembers(os, data, profile);
+                    os->writeLine("");
+                    os->writeLine("    return True;");
+                    os->writeLine("}");
+                }
+            }
+            else if (blockName == "writeBatch")
+            {
+                writeBatchWrite(os, data, profile);
+            }
+            else if (blockName == "template")
+            {
+                writeTemplateDecl(os, data, profile, False);
+            }
+        }
+        else
+        {
+            // line with 0 or many variables
+            parseVariable(outLine, data, m_prefix + m_suffix, m_suffix, profile);
+            os->writeLine(outLine);
+        }
+    }
+
+    os->writeLine("");
+}
+
+void DataFile::writeDataBench(const String &outPath, const String &cppExt, DataFile::Profile profile) const
+{
+    Stats &stats = m_generator.getStats();
+    StatsScope scope(stats, "DataFile::writeDataBench", m_filename, Stats::PHASE_NONE);
+
+    // only if concrete and non template data to bench
+    Bool something = False;
+    for (std::pair<String, Data*> entry : m_data)
+    {
+        if (!entry.second->abstract && entry.second->importLevel == 0 && entry.second->templatesArgs.empty())
+        {
+            something = True;
+            break;
+        }
+    }
+
+    if (!something)
+    {
+        stats.addFileSkipped(m_filename);
+        return;
+    }
+
+    String filename = getOutFileName(outPath, m_prefix + "Data.bench." + cppExt);
+
+    TextBuffer buffer;
+
+    for (const String &cppLine : m_generator.getTemplate(Generator::TPL_BENCH_CPP))
+    {
+        String outLine = cppLine;
+        Int32 p1;
+        Int32 p2;
+
+        if (outLine.isEmpty())
+            buffer.writeLine("");
+
+        // block
+        else if ((p1 = outLine.sub("@{", 0)) != -1)
+        {
+            p1 = 0;
+            p2 = outLine.find('}', p1+2);
+
+            if (p2 == -1)
+            {
+                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in bench.cpp.template"));
+            }
+
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "license")
+            {
+                // license
+                for (const String &line : m_generator.getTemplate(Generator::TPL_LICENCE))
+                {
+                    buffer.writeLine(line);
+                }
+            }
+            else if (blockName == "content")
+            {
+                for (std::pair<String,Data*> entry : m_data)
+                {
+                    Data *data = entry.second;
+                    if (!data->abstract && data->importLevel == 0 && data->templatesArgs.empty())
+                    {
+                        writeDataBenchContent(&buffer, data, profile);
+                        m_generator.registerBenchData(profile, data->name);
+                    }
+                }
+            }
+        }
+        else
+        {
+            // line with 0 or many variables
+            parseVariable(outLine, nullptr, m_prefix + m_suffix, m_suffix, profile);
+            buffer.writeLine(outLine);
+        }
+    }
+
+    writeOutput(filename, std::move(buffer), profile);
+}
+
+void DataFile::writeDataBenchContent(TextBuffer *os, Data *data, DataFile::Profile profile) const
+{
+    TargetType targetType = TargetType(profile + 1);
+
+    Generator::TemplateType tpl = profile == EDITOR ? Generator::TPL_DATA_BENCH_ENCODE : Generator::TPL_DATA_BENCH_DECODE;
+
+    for (const String &benchLine : m_generator.getTemplate(tpl))
+    {
+        String outLine = benchLine;
+        Int32 p1;
+        Int32 p2;
+
+        if (outLine.isEmpty())
+            os->writeLine("");
+
+        // block
+        else if ((p1 = outLine.sub("@{", 0)) != -1)
+        {
+            p2 = outLine.find('}', p1+2);
+
+            if (p2 == -1)
+            {
+                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in data.bench template"));
+            }
+
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "fill")
+            {
+                // inherited members first, using the inherited setters
+                std::list<Data*> chain;
+                for (Data *pdata = data; pdata != nullptr; pdata = pdata->directInherit)
+                {
+                    chain.push_front(pdata);
+                }
+
+                for (Data *pdata : chain)
+                {
+                    for (Member *member : pdata->members[T_COMMON])
+                    {
+                        member->writeBenchFill(os, "obj");
+                    }
+
+                    for (Member *member : pdata->members[targetType])
+                    {
+                        member->writeBenchFill(os, "obj");
+                    }
+                }
+            }
+        }
+        else
+        {
+            // line with 0 or many variables
+            parseVariable(outLine, data, m_prefix + m_suffix, m_suffix, profile);
+            os->writeLine(outLine);
+        }
+    }
+
+    os->writeLine("");
+}
+
+void DataFile::parseVariable(
+        String &outLine,
+        Data *data,
+        const String &header,
+        const String &classSuffix,
+        Profile profile) const
+{
+    Int32 p1, p2;
+
+    // line with 0 or many variables
+    while ((p1 = outLine.sub("${", 0)) != -1)
+    {
+        p2 = outLine.find('}', p1+2);
+
+        if (p2 == -1)
+            O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in template"));
+
+        String varName = outLine.sub(p1+2, p2);
+        outLine.remove(p1, p2-p1+1);
+
+        if (varName == "data")
+        {
+            outLine.insert(data->name, p1);
+        }
+        else if (varName == "dataId")
+        {
+            outLine.insert(String::print("%i", data->id), p1);
+        }
+        else if (varName == "author")
+        {
+            outLine.insert(m_generator.getAuthor(), p1);
+        }
+        else if (varName == "yyyy")
+        {
+            outLine.insert(m_generator.getYear(), p1);
+        }
+        else if (varName == "mm")
+        {
+            outLine.insert(m_generator.getMonth(), p1);
+        }
+        else if (varName == "dd")
+        {
+            outLine.insert(m_generator.getDay(), p1);
+        }
+        else if (varName == "stamp")
+        {
+            outLine.insert(m_stamp, p1);
+        }
+        else if (varName == "ns")
+        {
+            outLine.insert(m_generator.getNamespace(profile), p1);
+        }
+        else if (varName == "NS")
+        {
+            String NS = m_generator.getNamespace(profile);
+            NS.upper();
+
+            outLine.insert(NS, p1);
+        }
+        else if (varName == "header")
+        {
+            if (m_generator.getIncludePath(profile).isValid())
+                outLine.insert(m_generator.getIncludePath(profile) + "/" + m_pathname + "/" + header, p1);
+            else
+                outLine.insert(header, p1);
+        }
+        else if (varName == "benchheader")
+        {
+            outLine.insert(getRuntimeHeader("DataBench", profile), p1);
+        }
+        else if (varName == "hpp")
+        {
+            outLine.insert(m_generator.getHppExt(), p1);
+        }
+        else if (varName == "FILENAME")
+        {
+            String FILENAME = header;
+            FILENAME.upper();
+
+            outLine.insert(FILENAME, p1);
+        }
+        else if (varName == "HPP")
+        {
+            String HPP = m_generator.getHppExt();
+            HPP.upper();
+
+            outLine.insert(HPP, p1);
+        }
+        else if (varName ==  "baseclasses")
+        {
+            if (data->directInherit)
+            {
+                String baseclasses = ": public " + getBaseClass(data);
+                outLine.insert(baseclasses, p1);
+            }
+        }
+        else if (varName == "dataclass")
+        {
+            outLine.insert(getDataClass(data), p1);
+        }
+        else if (varName == "instream")
+        {
+            // the string views point into the buffer of a memory stream
+            outLine.insert(isViewed(data, profile) ? "DataMemoryInStream" : "o3d::InStream", p1);
+        }
+    }
+}
+
+Bool DataFile::isViewed(const Data *data, Profile profile) const
+{
+    std::vector<const Data*> visited;
+    return isViewed(data, profile, visited);
+}
+
+Bool DataFile::isViewed(const Data *data, Profile profile, std::vector<const Data*> &visited) const
+{
+    for (const Data *pdata = data; pdata != nullptr; pdata = pdata->directInherit)
+    {
+        if (std::find(visited.begin(), visited.end(), pdata) != visited.end())
+            return False;
+
+        visited.push_back(pdata);
+
+        if (isViewed(pdata->members[T_COMMON], profile, visited) ||
+            isViewed(pdata->members[getTarget(profile)], profile, visited))
+            return True;
+    }
+
+    return False;
+}
+
+Bool DataFile::isViewed(const T_MemberList &members, Profile profile,
+                        std::vector<const Data*> &visited) const
+{
+    for (const Member *member : members)
+    {
+        if (member->getType() == Member::TYPE_STRINGVIEW)
+            return True;
+
+        if (member->getChildren() && isViewed(*member->getChildren(), profile, visited))
+            return True;
+
+        if ((member->getType() == Member::TYPE_CUSTOM || member->getType() == Member::TYPE_CUSTOM_ARRAY) &&
+            static_cast<const MemberCustom*>(member)->isDataType())
+        {
+            String name = member->getTypeName();
+            if (name.endsWith("[]"))
+                name = name.sub(0, name.length() - 2);
+
+            auto it = m_data.find(name);
+            if (it != m_data.end() && isViewed(it->second, profile, visited))
+                return True;
+        }
+    }
+
+    return False;
+}
+
+Bool DataFile::isColumnar(const Data *data, Profile profile) const
+{
+    if (data->directInherit)
+        return False;
+
+    for (const Member *member : data->members[T_COMMON])
+    {
+        if (member->getColumn() == Member::COLUMN_ROWS)
+            return False;
+    }
+
+    for (const Member *member : data->members[getTarget(profile)])
+    {
+        if (member->getColumn() == Member::COLUMN_ROWS)
+            return False;
+    }
+
+    return True;
+}
+
+void DataFile::writeBatchWrite(TextBuffer *os, const Data *data, Profile profile) const
+{
+    if (!isColumnar(data, profile))
+    {
+        os->writeLine("    // rows, the data has a base class or a member which is not a column");
+        os->writeLine("    os.writeUInt8(0);");
+        os->writeLine("");
+        os->writeLine("    for (o3d::UInt32 i = 0; i < count; ++i)");
+        os->writeLine("    {");
+        os->writeLine("        records[i].writeToFile(os);");
+        os->writeLine("    }");
+        return;
+    }
+
+    os->writeLine("    // columns, the values of a member are contiguous");
+    os->writeLine("    os.writeUInt8(1);");
+    os->writeLine("");
+
+    for (const Member *member : data->members[T_COMMON])
+    {
+        if (member->getColumn() != Member::COLUMN_NONE)
+            member->writeColumnWrite(os);
+    }
+
+    for (const Member *member : data->members[getTarget(profile)])
+    {
+        if (member->getColumn() != Member::COLUMN_NONE)
+            member->writeColumnWrite(os);
+    }
+}
+
+void DataFile::writeBatchRead(TextBuffer *os, const Data *data, Profile profile) const
+{
+    os->writeLine("    o3d::UInt8 layout = is.readUInt8();");
+    os->writeLine("");
+    os->writeLine("    // rows");
+    os->writeLine("    if (layout == 0)");
+    os->writeLine("    {");
+    os->writeLine("        for (o3d::UInt32 i = 0; i < count; ++i)");
+    os->writeLine("        {");
+    os->writeLine("            records[i].readFromFile(is);");
+    os->writeLine("        }");
+    os->writeLine("");
+    os->writeLine("        return;");
+    os->writeLine("    }");
+    os->writeLine("");
+
+    if (!isColumnar(data, profile))
+    {
+        os->writeLine("    O3D_ERROR(o3d::E_InvalidFormat(\"" + data->name + " batch must be written by rows\"));");
+        return;
+    }
+
+    os->writeLine("    if (layout != 1)");
+    os->writeLine("    {");
+    os->writeLine("        O3D_ERROR(o3d::E_InvalidFormat(\"Unknown batch layout\"));");
+    os->writeLine("    }");
+    os->writeLine("");
+
+    for (const Member *member : data->members[T_COMMON])
+    {
+        if (member->getColumn() != Member::COLUMN_NONE)
+            member->writeColumnRead(os);
+    }
+
+    for (const Member *member : data->members[getTarget(profile)])
+    {
+        if (member->getColumn() != Member::COLUMN_NONE)
+            member->writeColumnRead(os);
+    }
+}
+
+void DataFile::writeReadMembers(TextBuffer *os, const Data *data, Profile profile) const
+{
+    // inherited class, with the string table if any
+    if (data->directInherit)
+    {
+        if (m_generator.isPackStrings())
+            os->writeLine("    " + getBaseClass(data) + "::readFromFile(is, strings);");
+        else
+            os->writeLine("    " + getBaseClass(data) + "::readFromFile(is);");
+
+        os->writeLine("");
+    }
+
+    for (Member *member : data->members[T_COMMON])
+    {
+        member->writeRead(os);
+    }
+
+    for (Member *member : data->members[getTarget(profile)])
+    {
+        member->writeRead(os);
+    }
+}
+
+void DataFile::writeWriteMembers(TextBuffer *os, const Data *data, Profile profile) const
+{
+    // inherited class, with the string table if any
+    if (data->directInherit)
+    {
+        if (m_generator.isPackStrings())
+            os->writeLine("    " + getBaseClass(data) + "::writeToFile(os, strings);");
+        else
+            os->writeLine("    " + getBaseClass(data) + "::writeToFile(os);");
+
+        os->writeLine("");
+    }
+
+    for (Member *member : data->members[T_COMMON])
+    {
+        member->writeWrite(os);
+    }
+
+    for (Member *member : data->members[getTarget(profile)])
+    {
+        member->writeWrite(os);
+    }
+}
+
+void DataFile::writeReset(TextBuffer *os, const Data *data, Profile profile) const
+{
+    // inherited class
+    if (data->directInherit)
+    {
+        os->writeLine("    " + getBaseClass(data) + "::reset();");
+        os->writeLine("");
+    }
+
+    for (Member *member : data->members[T_COMMON])
+    {
+        member->writeReset(os);
+    }
+
+    for (Member *member : data->members[getTarget(profile)])
+    {
+        member->writeReset(os);
+    }
+
+    // as the constructor
+    for (Member *member : data->initializers)
+    {
+        if (!member->getValue().startsWith("<"))
+            os->writeLine("    " + member->getPrefixedName() + " = " + member->getValue() + ";");
+        else if (isExplicitTemplate(data))
+        {
+            String arg = member->getValue();
+            arg.trimLeft('<');
+            arg.trimRight('>');
+
+            os->writeLine("    " + member->getPrefixedName() + " = " + arg + ";");
+        }
+    }
+}
+
+void DataFile::updateHeader(TargetType target, const T_StringList &headers, DataFile::FileType fileType)
+{
+    if (headers.empty())
+        return;
+
+    // add the header if necessary
+    Bool hd = True;
+    for (const String &memberHeader : headers)
+    {
+        hd = True;
+        for (const String &currHeader : m_includes[target][fileType])
+        {
+            if (memberHeader == currHeader)
+            {
+                hd = False;
+                break;
+            }
+        }
+
+        if (hd)
+            m_includes[target][fileType].push_back(memberHeader);
+    }
+}
+
+Bool DataFile::isExplicitTemplate(const Data *data) const
+{
+    // abstract data and composition inject the members, there is no base class
+    return m_generator.isExplicitTemplates() && !data->templatesArgs.empty() && !data->abstract && !m_composite;
+}
+
+Bool DataFile::isImplemented(const Data *data, Bool templates) const
+{
+    return !data->abstract && data->importLevel == 0 && isExplicitTemplate(data) == templates;
+}
+
+String DataFile::getTemplateDecl(const Data *data) const
+{
+    if (!isExplicitTemplate(data))
+        return String();
+
+    String decl = "template <";
+
+    UInt32 n = 0;
+    for (const String &arg : data->templatesArgs)
+    {
+        if (n++ > 0)
+            decl += ", ";
+
+        decl += "o3d::Int32 " + arg;
+    }
+
+    return decl + ">";
+}
+
+String DataFile::getDataClass(const Data *data) const
+{
+    String dataClass = data->name + m_suffix;
+
+    if (isExplicitTemplate(data))
+    {
+        dataClass += "<";
+
+        UInt32 n = 0;
+        for (const String &arg : data->templatesArgs)
+        {
+            if (n++ > 0)
+                dataClass += ", ";
+
+            dataClass += arg;
         }
+
+        dataClass += ">";
     }
 
-    os->writeLine("");
+    return dataClass;
 }
 
-void DataFile::writeDataWriterImplContent(OutStream *os, Data *data, DataFile::Profile profile)
+String DataFile::getBaseClass(const Data *data) const
 {
-    for (const String &outImplLine : Main::instance()->getTemplate(Main::TPL_DATA_WRITER_IMPL))
-    {
-        String outLine = outImplLine;
-        Int32 p1;
-        Int32 p2;
+    if (!data->directInherit)
+        return String();
 
-        if (outLine.isEmpty())
-            os->writeLine("");
+    String baseClass = data->directInherit->name + m_suffix;
 
-        // block
-        else if ((p1 = outLine.sub("@{", 0)) != -1)
+    if (isExplicitTemplate(data->directInherit))
+    {
+        baseClass += "<";
+
+        // values given at inheritance, or arguments of this template
+        UInt32 n = 0;
+        for (const TemplateParam &tpl : data->templatesParams)
         {
-            p2 = outLine.find('}', p1+2);
+            if (n++ > 0)
+                baseClass += ", ";
 
-            if (p2 == -1)
+            // a constant of an inherited data must be qualified, the base clause
+            // and the explicit instantiations are out of the class scope
+            Data *pdata = tpl.resolved ? data->directInherit : nullptr;
+            while (pdata && !pdata->getMember(tpl.value))
             {
-                deletePtr(os);
-                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in msg.out.impl.template"));
+                pdata = pdata->directInherit;
             }
 
-            String blockName = outLine.sub(p1+2, p2);
-            if (blockName == "writeToFile")
-            {
-                // inherited class
-                if (data->directInherit)
-                {
-                    String line = "    " + data->directInherit->name + m_suffix + "::writeToFile(os);";
-                    os->writeLine(line);
-                    os->writeLine("");
-                }
+            if (pdata)
+                baseClass += pdata->name + m_suffix + "::" + tpl.value;
+            else
+                baseClass += tpl.value;
+        }
 
-                for (Member *member : data->members[T_COMMON])
-                {
-                    member->writeWrite(os);
-                }
+        baseClass += ">";
+    }
 
-                for (Member *member : data->members[m_currentType])
-                {
-                    member->writeWrite(os);
-                }
+    return baseClass;
+}
+
+void DataFile::writeTemplateDecl(TextBuffer *os, const Data *data, Profile profile, Bool header) const
+{
+    // the base class template is instantiated once, by the explicit instantiations file
+    if (header && data->directInherit && isExplicitTemplate(data->directInherit))
+    {
+        Bool resolved = True;
+        for (const TemplateParam &tpl : data->templatesParams)
+        {
+            if (!tpl.resolved)
+            {
+                resolved = False;
+                break;
             }
         }
-        else
+
+        if (resolved)
         {
-            // line with 0 or many variables
-            parseVariable(outLine, data, m_prefix + m_suffix, m_suffix, profile);
-            os->writeLine(outLine);
+            String baseClass = getBaseClass(data);
+
+            os->writeLine("extern template class " + baseClass + ";");
+            os->writeLine("");
+
+            m_generator.registerInstantiation(profile, baseClass);
         }
     }
 
-    os->writeLine("");
+    String decl = getTemplateDecl(data);
+    if (decl.isValid())
+        os->writeLine(decl);
 }
 
-void DataFile::parseVariable(
-        String &outLine,
-        Data *data,
-        const String &header,
-        const String &classSuffix,
-        Profile profile)
+void DataFile::registerTemplateFile(Profile profile, const String &name) const
 {
-    Int32 p1, p2;
+    m_generator.registerTemplateFile(profile, m_pathname.isValid() ? m_pathname + "/" + name : name);
+}
 
-    // line with 0 or many variables
-    while ((p1 = outLine.sub("${", 0)) != -1)
+HeaderFanOut DataFile::getHeaderFanOut(const String &filename, Profile profile) const
+{
+    HeaderFanOut fanOut;
+    fanOut.filename = filename;
+    fanOut.includes = fanOut.models = fanOut.cppIncludes = 0;
+    fanOut.predecls = (UInt32)m_preClass.size();
+
+    const TargetType targets[2] = { T_COMMON, getTarget(profile) };
+    for (TargetType target : targets)
     {
-        p2 = outLine.find('}', p1+2);
+        for (const String &header : m_includes[target][F_HPP])
+        {
+            ++fanOut.includes;
 
-        if (p2 == -1)
-            O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in template"));
+            // generated data headers are quoted, others are <>
+            if (header.startsWith("\""))
+                ++fanOut.models;
+        }
 
-        String varName = outLine.sub(p1+2, p2);
-        outLine.remove(p1, p2-p1+1);
+        fanOut.cppIncludes += (UInt32)m_includes[target][F_CPP].size();
+    }
 
-        if (varName == "data")
-        {
-            outLine.insert(data->name, p1);
-        }
-        else if (varName == "dataId")
-        {
-            outLine.insert(String::print("%i", data->id), p1);
-        }
-        else if (varName == "author")
-        {
-            outLine.insert(Main::instance()->getAuthor(), p1);
-        }
-        else if (varName == "yyyy")
-        {
-            outLine.insert(Main::instance()->getYear(), p1);
-        }
-        else if (varName == "mm")
-        {
-            outLine.insert(Main::instance()->getMonth(), p1);
-        }
-        else if (varName == "dd")
-        {
-            outLine.insert(Main::instance()->getDay(), p1);
-        }
-        else if (varName == "ns")
-        {
-            outLine.insert(Main::instance()->getNamespace(profile), p1);
-        }
-        else if (varName == "NS")
-        {
-            String NS = Main::instance()->getNamespace(profile);
-            NS.upper();
+    return fanOut;
+}
 
-            outLine.insert(NS, p1);
-        }
-        else if (varName == "header")
-        {
-            if (Main::instance()->getIncludePath(profile).isValid())
-                outLine.insert(Main::instance()->getIncludePath(profile) + "/" + m_pathname + "/" + header, p1);
-            else
-                outLine.insert(header, p1);
-        }
-        else if (varName == "hpp")
+String DataFile::getRuntimeHeader(const String &name, Profile profile) const
+{
+    String header = name + "." + m_generator.getHppExt();
+
+    if (m_generator.getIncludePath(profile).isValid())
+        return m_generator.getIncludePath(profile) + "/" + header;
+    else if (m_pathname.isValid())
+        return "../" + header;
+    else
+        return header;
+}
+
+String DataFile::getSourceName() const
+{
+    String name = m_filename.sub(m_generator.getInPath().length() + 1, -1);
+
+    Int32 pos = name.reverseFind('.');
+    return pos > 0 ? name.sub(0, pos) : name;
+}
+
+void DataFile::writeOutput(const String &filename, TextBuffer &&buffer, Profile profile) const
+{
+    Stats &stats = m_generator.getStats();
+
+    // before the buffer is given to the output
+    if (m_generator.isReport())
+        m_generator.registerOutput(profile, getSourceName(), filename, buffer);
+
+    UInt64 size = buffer.getSize();
+
+    {
+        StatsScope writeScope(stats, "write", m_filename, Stats::PHASE_WRITE);
+
+        m_generator.getOutputSink().write(filename, std::move(buffer));
+        stats.addBytesWritten(m_filename, size);
+    }
+}
+
+//! Count the members of a list, and the children of the loops and ifs.
+static void countMembers(const T_MemberList &members, DataReport &report)
+{
+    for (const Member *member : members)
+    {
+        ++report.members;
+
+        if (member->getBuiltinType() == BT_LOOP)
+            ++report.loops;
+        else if (member->getBuiltinType() == BT_IF)
+            ++report.ifs;
+        else if (member->getType() == Member::TYPE_CUSTOM_REF)
+            ++report.refs;
+
+        if (member->getChildren())
+            countMembers(*member->getChildren(), report);
+    }
+}
+
+DataReport DataFile::getReport(Profile profile) const
+{
+    DataReport report;
+    report.source = getSourceName();
+
+    for (std::pair<String, Data*> entry : m_data)
+    {
+        const Data *data = entry.second;
+        if (data->abstract || data->importLevel != 0)
+            continue;
+
+        report.data.push_back(data->name);
+
+        UInt32 depth = 0;
+        for (const Data *base = data->directInherit; base != nullptr; base = base->directInherit)
         {
-            outLine.insert(Main::instance()->getHppExt(), p1);
+            ++depth;
         }
-        else if (varName == "FILENAME")
-        {
-            String FILENAME = header;
-            FILENAME.upper();
 
-            outLine.insert(FILENAME, p1);
-        }
-        else if (varName == "HPP")
-        {
-            String HPP = Main::instance()->getHppExt();
-            HPP.upper();
+        if (depth > report.depth)
+            report.depth = depth;
 
-            outLine.insert(HPP, p1);
-        }
-        else if (varName ==  "baseclasses")
+        countMembers(data->members[T_COMMON], report);
+        countMembers(data->members[getTarget(profile)], report);
+    }
+
+    // source directory, the generated includes are relative to it
+    std::vector<String> dir;
+    StringTokenizer dirTk(report.source, "/");
+    while (dirTk.hasMoreTokens())
+    {
+        dir.push_back(dirTk.nextToken());
+    }
+
+    if (!dir.empty())
+        dir.pop_back();
+
+    String dataHpp = "Data." + m_generator.getHppExt();
+
+    const TargetType targets[2] = { T_COMMON, getTarget(profile) };
+    for (TargetType target : targets)
+    {
+        for (const String &header : m_includes[target][F_HPP])
         {
-            if (data->directInherit)
+            ++report.includes;
+
+            // generated data headers are quoted, others are <>
+            if (!header.startsWith("\"") || !header.endsWith(dataHpp + "\""))
+                continue;
+
+            std::vector<String> path = dir;
+            StringTokenizer tk(header.sub(1, header.length() - 1 - dataHpp.length()), "/");
+
+            while (tk.hasMoreTokens())
             {
-                String baseclasses = ": public " + data->directInherit->name + classSuffix;
-                outLine.insert(baseclasses, p1);
+                String segment = tk.nextToken();
+
+                if (segment == "..")
+                {
+                    if (!path.empty())
+                        path.pop_back();
+                }
+                else if (segment != ".")
+                {
+                    path.push_back(segment);
+                }
             }
+
+            String include;
+            for (const String &segment : path)
+            {
+                include += include.isValid() ? "/" + segment : segment;
+            }
+
+            report.modelIncludes.push_back(include);
         }
     }
+
+    return report;
 }
 
-void DataFile::updateHeader(const T_StringList &headers, DataFile::FileType fileType)
+void DataFile::findImportHeader(const String &data, T_StringList &headers) const
 {
-    if (headers.empty())
-        return;
-
-    // add the header if necessary
-    Bool hd = True;
-    for (const String &memberHeader : headers)
+    for (const String &header : m_imports)
     {
-        hd = True;
-        for (const String &currHeader : m_includes[m_currentType][fileType])
+        if (!header.endsWith(data))
+            continue;
+
+        // add corresponding header
+        Int32 p = header.sub(data, 0);
+        if (p == -1)
         {
-            if (memberHeader == currHeader)
+            break;
+        }
+        else if (p == 0)
+        {
+            headers.push_back("\"" + header + "Data." + m_generator.getHppExt() + "\"");
+            break;
+        }
+        else if (p > 0)
+        {
+            if (header[p-1] == '/')
             {
-                hd = False;
+                headers.push_back("\"" + header + "Data." + m_generator.getHppExt() + "\"");
                 break;
             }
         }
-
-        if (hd)
-            m_includes[m_currentType][fileType].push_back(memberHeader);
     }
 }
 
@@ -1991,7 +2949,7 @@ void DataFile::updateClasses(const String &classname)
     m_preClass.push_back(classname);
 }
 
-void DataFile::parseData(InStream *is, const String &_line, Int32 pass)
+void DataFile::parseData(TextReader *is, const String &_line, Int32 pass)
 {
     Tokenizer tk(_line, ":{}<>,");
     String type;
@@ -2066,53 +3024,35 @@ void DataFile::parseData(InStream *is, const String &_line, Int32 pass)
                     MemberCustom *member = new MemberCustom(nullptr);
                     member->setTypeName(data);
                     member->setOutTypeName(data + m_suffix);
+                    member->setDataType(True);
+                    member->setPackStrings(m_generator.isPackStrings());
                     member->setTemplatesArgs(pdata->templatesArgs);
-                    MemberFactory::instance()->registerMember(member);
+                    m_generator.getMemberFactory().registerMember(member);
 
                     // array
                     MemberCustomArray *memberArray = new MemberCustomArray(nullptr);
                     memberArray->setTypeName(data + "[]");
                     memberArray->setOutTypeName(data + m_suffix);
+                    memberArray->setDataType(True);
+                    memberArray->setPackStrings(m_generator.isPackStrings());
                     memberArray->setTemplatesArgs(pdata->templatesArgs);
-                    MemberFactory::instance()->registerMember(memberArray);
+                    m_generator.getMemberFactory().registerMember(memberArray);
 
                     // reference
                     MemberCustomRef *memberRef = new MemberCustomRef(nullptr);
                     memberRef->setTypeName(data + "&");
                     memberRef->setOutTypeName(data + m_suffix);
                     memberRef->setTemplatesArgs(pdata->templatesArgs);
-                    MemberFactory::instance()->registerMember(memberRef);
+                    m_generator.getMemberFactory().registerMember(memberRef);
 
                     // find the corresponding header into the import list
                     T_StringList headers;
-                    for (const String &header : m_imports)
-                    {
-                        if (!header.endsWith(data))
-                            continue;
-
-                        // add corresponding header
-                        Int32 p = header.sub(data, 0);
-                        if (p == -1)
-                        {
-                            break;
-                        }
-                        else if (p == 0)
-                        {
-                            headers.push_back("\"" + header + "Data." + Main::instance()->getHppExt() + "\"");
-                            break;
-                        }
-                        else if (p > 0)
-                        {
-                            if (header[p-1] == '/')
-                            {
-                                headers.push_back("\"" + header + "Data." + Main::instance()->getHppExt() + "\"");
-                                break;
-                            }
-                        }
-                    }
+                    findImportHeader(data, headers);
 
                     member->setHeaders(headers);
                     memberArray->setHeaders(headers);
+                    // only included by the implementation, the header uses a predeclaration
+                    memberRef->setHeaders(headers);
                 }
                 // update
                 else
@@ -2197,7 +3137,7 @@ void DataFile::parseData(InStream *is, const String &_line, Int32 pass)
 
         // auto id
         if (id != 0)
-            Main::instance()->registerDataId(id);
+            m_generator.registerDataId(id);
 
         // inheritance
         if (inheritFrom.isValid())
@@ -2249,34 +3189,10 @@ void DataFile::parseData(InStream *is, const String &_line, Int32 pass)
         if (pdata->directInherit)
         {
             T_StringList headers;
-            for (const String &header : m_imports)
-            {
-                if (!header.endsWith(pdata->directInherit->name))
-                    continue;
-
-                // add corresponding header
-                Int32 p = header.sub(pdata->directInherit->name, 0);
-                if (p == -1)
-                {
-                    break;
-                }
-                else if (p == 0)
-                {
-                    headers.push_back("\"" + header + "Data." + Main::instance()->getHppExt() + "\"");
-                    break;
-                }
-                else if (p > 0)
-                {
-                    if (header[p-1] == '/')
-                    {
-                        headers.push_back("\"" + header + "Data." + Main::instance()->getHppExt() + "\"");
-                        break;
-                    }
-                }
-            }
+            findImportHeader(pdata->directInherit->name, headers);
 
             if (m_currentImportLevel == 0)
-                updateHeader(headers, F_HPP);
+                updateHeader(m_currentType, headers, F_HPP);
         }
 
         parseDataInt(is, begin, pdata);
@@ -2288,7 +3204,7 @@ void DataFile::parseData(InStream *is, const String &_line, Int32 pass)
     }
 }
 
-void DataFile::parseTemplate(InStream *is, const String &_line)
+void DataFile::parseTemplate(TextReader *is, const String &_line)
 {
     Tokenizer tk(_line, "<>,");
     String token;
@@ -2356,7 +3272,7 @@ void DataFile::parseTemplate(InStream *is, const String &_line)
         m_templateSpe = True;
 }
 
-void DataFile::parseDataInt(InStream *is, Bool begin, Data *data)
+void DataFile::parseDataInt(TextReader *is, Bool begin, Data *data)
 {
     // inject members of inherited data if abstract or m_composite is enable
     // we do it here, because here we are in the second pass
@@ -2491,7 +3407,7 @@ void DataFile::parseDataInt(InStream *is, Bool begin, Data *data)
 }
 
 void DataFile::parseDataLoop(
-        InStream *is,
+        TextReader *is,
         const String &_line,
         Data *data,
         Member *parent)
@@ -2622,14 +3538,14 @@ void DataFile::parseDataLoop(
     {
         if (UInteger32::isInteger(counterVarParam))
         {
-            constMember = MemberFactory::instance()->buildFromTypeName("immediate", nullptr);
+            constMember = m_generator.getMemberFactory().buildFromTypeName("immediate", nullptr);
             constMember->setName(UInteger32::toString(varMember->getNewUIntId()));
 
             addMember(m_currentType, data, constMember, nullptr);
         }
         else
         {
-            constMember = MemberFactory::instance()->buildFromTypeName("const uint32", nullptr);
+            constMember = m_generator.getMemberFactory().buildFromTypeName("const uint32", nullptr);
             constMember->setName(counterVarParam);
             constMember->setValue(UInteger32::toString(varMember->getNewUIntId()));
 
@@ -2638,7 +3554,8 @@ void DataFile::parseDataLoop(
     }
 
     // create the loop member
-    Member *member = MemberFactory::instance()->buildFromTypeName("loop", parent);
+    Member *member = m_generator.getMemberFactory().buildFromTypeName("loop", parent);
+    static_cast<MemberLoop*>(member)->setArena(m_generator.isArena());
     member->setName(loopName);
     member->setCond(varMember, constMember);
 
@@ -2730,10 +3647,21 @@ void DataFile::parseDataLoop(
             }
         }
     }
+
+    // arena = true, the arena reset leaves the elements : they must own nothing
+    if (m_generator.isArena())
+    {
+        for (const Member *child : *member->getChildren())
+        {
+            if (!child->isTriviallyDestructible())
+                O3D_ERROR(E_InvalidFormat("arena = true : " + child->getName() + " of the loop " +
+                                          loopName + " owns heap memory, use string<N> or stringview"));
+        }
+    }
 }
 
 void DataFile::parseDataIf(
-        InStream *is,
+        TextReader *is,
         const String &_line,
         Data *data,
         Member *parent)
@@ -2844,14 +3772,14 @@ void DataFile::parseDataIf(
     {
         if (UInteger32::isInteger(condVarParam))
         {
-            constMember = MemberFactory::instance()->buildFromTypeName("immediate", nullptr);
+            constMember = m_generator.getMemberFactory().buildFromTypeName("immediate", nullptr);
             constMember->setName(UInteger32::toString(varMember->getNewUIntId()));
 
             addMember(m_currentType, data, constMember, nullptr);
         }
         else
         {
-            constMember = MemberFactory::instance()->buildFromTypeName("const uint32", nullptr);
+            constMember = m_generator.getMemberFactory().buildFromTypeName("const uint32", nullptr);
             constMember->setName(condVarParam);
             constMember->setValue(UInteger32::toString(varMember->getNewUIntId()));
 
@@ -2860,7 +3788,7 @@ void DataFile::parseDataIf(
     }
 
     // create the if member
-    Member *member = MemberFactory::instance()->buildFromTypeName("if", parent);
+    Member *member = m_generator.getMemberFactory().buildFromTypeName("if", parent);
     member->setName("if");
     member->setCond(varMember, constMember);
 
@@ -2954,7 +3882,7 @@ void DataFile::parseDataIf(
 }
 
 void DataFile::parseDataMember(
-        InStream *is,
+        TextReader *is,
         const String &_line,
         Data *data,
         Member *parent)
@@ -3002,7 +3930,8 @@ void DataFile::parseDataMember(
                 continue;
             else
             {
-                if (!tk.isName(token))
+                // string<N> takes an integer
+                if (!tk.isName(token) && !(type == "string" && token.isValid() && token[0] >= '0' && token[0] <= '9'))
                     O3D_ERROR(E_InvalidFormat("template argument must be a litteral"));
 
                 templateArgs.push_back(token);
@@ -3054,12 +3983,12 @@ void DataFile::parseDataMember(
             O3D_ERROR(E_InvalidOperation("a reference member cannot have an initial value"));
         }
 
-        member = MemberFactory::instance()->buildFromTypeName(type + "&", parent);
+        member = m_generator.getMemberFactory().buildFromTypeName(type + "&", parent);
         // MemberCustomRef *memberRef = dynamic_cast<MemberCustomRef*>(member);
         MemberCustomRef *memberRef = static_cast<MemberCustomRef*>(member);
 
         // TODO identifier type may be took from referenced member class, if referencable...
-        Member *identifier = MemberFactory::instance()->buildFromTypeName("int32", parent);
+        Member *identifier = m_generator.getMemberFactory().buildFromTypeName("int32", parent);
         identifier->setName(name + "Id");
 
         auto itd = m_data.find(type);
@@ -3083,10 +4012,12 @@ void DataFile::parseDataMember(
         // need to satisfy this member in finalize
         data->finalizers.push_back(member);
 
-        // class predeclaration, and we dont update the headers
+        // class predeclaration into the header, the header of the data is only
+        // included by the implementation
         if (m_currentImportLevel == 0)
         {
             updateClasses(type + m_suffix);
+            updateHeader(m_currentType, member->getHeaders(), F_CPP);
 
             // add for later inclusion of headers into the cpp files.
             // later, because here we couldnt be sure to have parsed the annotations
@@ -3096,7 +4027,23 @@ void DataFile::parseDataMember(
     }
     else
     {
-        member = MemberFactory::instance()->buildFromTypeName(type, parent);
+        // @encoding integers = varint
+        if (data->varIntIntegers && (type == "int32" || type == "uint32" || type == "int64" || type == "uint64"))
+            type = "var" + type;
+
+        // string<N>, inline
+        if (type == "string" && !templateArgs.empty())
+            type = "string<>";
+
+        // @encoding strings = utf8
+        if (data->utf8Strings && type == "string")
+            type = "utf8string";
+
+        member = m_generator.getMemberFactory().buildFromTypeName(type, parent);
+
+        // pack.strings = true
+        if (member->getType() == Member::TYPE_STRING && m_generator.isPackStrings())
+            static_cast<MemberString*>(member)->setInterned(True);
 
         // initial value
         if (value.isValid())
@@ -3126,7 +4073,7 @@ void DataFile::parseDataMember(
 
         // add the header if necessary
         if (m_currentImportLevel == 0)
-            updateHeader(member->getHeaders(), F_HPP);
+            updateHeader(m_currentType, member->getHeaders(), F_HPP);
     }
 
     member->setName(name);
@@ -3157,7 +4104,7 @@ void DataFile::parseDataMember(
 }
 
 void DataFile::parseDataArray(
-        InStream *is,
+        TextReader *is,
         const String &_line,
         Data *data,
         Member *parent)
@@ -3262,10 +4209,24 @@ void DataFile::parseDataArray(
     if (nextState != 40)
         O3D_ERROR(E_InvalidFormat("invalid array member expression"));
 
-    Member *member = MemberFactory::instance()->buildFromTypeName(type + "[]", parent);
+    Member *member = m_generator.getMemberFactory().buildFromTypeName(type + "[]", parent);
     member->setName(name);
     member->setValue(size);
 
+    // @encoding sizes = varint
+    if (data->varIntSizes && member->getType() == Member::TYPE_CUSTOM_ARRAY)
+        static_cast<MemberCustomArray*>(member)->setVarIntSize(True);
+
+    // arena = true, the arena reset leaves the elements : not for a data (virtual destructor)
+    if (m_generator.isArena() && member->getType() == Member::TYPE_CUSTOM_ARRAY)
+    {
+        if (static_cast<MemberCustomArray*>(member)->isDataType())
+            O3D_ERROR(E_InvalidFormat("arena = true : the elements of " + name + " are " + type +
+                                      " data, having a destructor"));
+
+        static_cast<MemberCustomArray*>(member)->setArena(True);
+    }
+
     // finalize if the type name refer to a data type name
     if (m_data.find(type) != m_data.end())
     {
@@ -3275,7 +4236,7 @@ void DataFile::parseDataArray(
 
     // add the header if necessary
     if (m_currentImportLevel == 0)
-        updateHeader(member->getHeaders(), F_HPP);
+        updateHeader(m_currentType, member->getHeaders(), F_HPP);
 
     addMember(m_currentType, data, member, parent);
 
@@ -3283,7 +4244,7 @@ void DataFile::parseDataArray(
 }
 
 void DataFile::parseDataConst(
-        InStream *is,
+        TextReader *is,
         const String &_line,
         Data *data,
         Member *parent,
@@ -3352,7 +4313,7 @@ void DataFile::parseDataConst(
     if (nextState != 10)
         O3D_ERROR(E_InvalidFormat("invalid const member expression"));
 
-    Member *member = MemberFactory::instance()->buildFromTypeName("const " + type, parent);
+    Member *member = m_generator.getMemberFactory().buildFromTypeName("const " + type, parent);
     member->setName(name);
     member->setValue(value);
 
@@ -3362,14 +4323,14 @@ void DataFile::parseDataConst(
 
     // add the header if necessary
     if (m_currentImportLevel == 0)
-        updateHeader(member->getHeaders(), F_HPP);
+        updateHeader(m_currentType, member->getHeaders(), F_HPP);
 
     addMember(m_currentType, data, member, parent);
 
     //System::print(member->getTypeName(), name);
 }
 
-void DataFile::parseDataBit(InStream *is, const String &_line, Data *data, Member *parent)
+void DataFile::parseDataBit(TextReader *is, const String &_line, Data *data, Member *parent)
 {
     Tokenizer tk(_line, "=");
     String token;
@@ -3470,7 +4431,7 @@ void DataFile::parseDataBit(InStream *is, const String &_line, Data *data, Membe
             O3D_ERROR(E_InvalidParameter("const value must be a litteral"));
         else
         {
-            bitMember = MemberFactory::instance()->buildFromTypeName("bit", nullptr);
+            bitMember = m_generator.getMemberFactory().buildFromTypeName("bit", nullptr);
             bitMember->setName(constName);
             bitMember->setCond(varMember, bitMember);
             bitMember->setValue(UInteger32::toString(varMember->getNewUIntId()));
@@ -3482,17 +4443,17 @@ void DataFile::parseDataBit(InStream *is, const String &_line, Data *data, Membe
     }
 }
 
-void DataFile::parseDataExtern(InStream *is, const String &line, Data *data, Member *parent)
+void DataFile::parseDataExtern(TextReader *is, const String &line, Data *data, Member *parent)
 {
     // TODO
 }
 
-void DataFile::parseDataStatic(InStream *is, const String &line, Data *data, Member *parent)
+void DataFile::parseDataStatic(TextReader *is, const String &line, Data *data, Member *parent)
 {
     // TODO
 }
 
-void DataFile::parseAnnotation(InStream *is, const String &_line, Data *data)
+void DataFile::parseAnnotation(TextReader *is, const String &_line, Data *data)
 {
     String token;
     String name;
@@ -3614,6 +4575,33 @@ void DataFile::parseAnnotation(InStream *is, const String &_line, Data *data)
                 O3D_ERROR(E_InvalidFormat("unsupported annotation parameter"));
         }
     }
+    else if (name == "encoding")
+    {
+        // applies to the members following the annotation
+        for (Param &p : params)
+        {
+            if (p.name == "strings")
+            {
+                if (p.values.size() != 1 || (p.values.front() != "utf8" && p.values.front() != "wide"))
+                    O3D_ERROR(E_InvalidFormat("strings encoding must be utf8 or wide"));
+
+                data->utf8Strings = p.values.front() == "utf8";
+                continue;
+            }
+
+            if (p.values.size() != 1 || (p.values.front() != "varint" && p.values.front() != "fixed"))
+                O3D_ERROR(E_InvalidFormat("encoding must be varint or fixed"));
+
+            Bool varInt = p.values.front() == "varint";
+
+            if (p.name == "sizes")
+                data->varIntSizes = varInt;
+            else if (p.name == "integers")
+                data->varIntIntegers = varInt;
+            else
+                O3D_ERROR(E_InvalidFormat("unsupported annotation parameter"));
+        }
+    }
     else if (name == "form")
     {
         // TODO
@@ -13,6 +13,7 @@
 #include <o3d/core/stringlist.h>
 #include <o3d/core/stringmap.h>
 #include "member.h"
+#include "textbuffer.h"
 
 #include <vector>
 
@@ -20,6 +21,7 @@ namespace o3d {
 namespace dmg {
 
 struct Data;
+class Generator;
 
 typedef std::list<Member*> T_MemberList;
 typedef T_MemberList::iterator IT_MemberList;
@@ -40,6 +42,49 @@ typedef std::vector<TemplateParam> T_TemplateParamVector;
 typedef T_TemplateParamVector::iterator IT_TemplateParamVector;
 typedef T_TemplateParamVector::const_iterator CIT_TemplateParamVector;
 
+//! Direct includes of a generated header.
+struct HeaderFanOut
+{
+    String filename;
+    UInt32 includes;     //!< includes of the header
+    UInt32 models;       //!< of which generated data headers
+    UInt32 predecls;     //!< classes only predeclared
+    UInt32 cppIncludes;  //!< includes of the implementation
+};
+
+/**
+ * @brief Size and compile cost of the generated files of a data file for a profile,
+ * for the --report table.
+ */
+struct DataReport
+{
+    DataReport() :
+        lines(0),
+        headerLines(0),
+        bytes(0),
+        includes(0),
+        depth(0),
+        members(0),
+        loops(0),
+        ifs(0),
+        refs(0)
+    {
+    }
+
+    String source;              //!< data file relative to the input, without extension
+    T_StringList data;          //!< exported data
+    UInt32 lines;               //!< of the generated files (header and implementations)
+    UInt32 headerLines;         //!< of the generated header
+    UInt64 bytes;
+    UInt32 includes;            //!< direct includes of the header
+    T_StringList modelIncludes; //!< included generated headers, as their source
+    UInt32 depth;               //!< deepest inheritance of the exported data
+    UInt32 members;             //!< of the exported data, with the loops and ifs children
+    UInt32 loops;
+    UInt32 ifs;
+    UInt32 refs;                //!< custom references (Type&)
+};
+
 struct IdentifierMetaData
 {
     IdentifierMetaData()
@@ -78,7 +123,10 @@ struct Data
         directInherit(nullptr),
         id(-1),
         minSize(0),
-        identifier(nullptr)
+        identifier(nullptr),
+        varIntSizes(False),
+        varIntIntegers(False),
+        utf8Strings(False)
     {
     }
 
@@ -130,6 +178,13 @@ struct Data
     //! extern members are declared from an inherited class, and used with initializers
     T_MemberList externs;
 
+    //! @encoding sizes = varint, for the following custom arrays
+    Bool varIntSizes;
+    //! @encoding integers = varint, for the following 32 and 64 bits integers
+    Bool varIntIntegers;
+    //! @encoding strings = utf8, for the following strings
+    Bool utf8Strings;
+
     //! statics members are only declared, but not implemented (no read/write...)
     T_MemberList statics;
 };
@@ -172,6 +227,7 @@ public:
     };
 
     DataFile(
+            Generator &generator,
             const String &path,
             const String &filename,
             const String &suffix,
@@ -184,14 +240,26 @@ public:
     void parseClassFile();
     void parseTypedefFile();
 
-    void process();
+    //! Data ids, includes, templates initializers and members derived names.
+    //! Nothing is modified after, until the end of the render.
+    void link();
+
+    //! Render and write the files of a profile. The profiles of a linked file can be
+    //! rendered concurrently.
+    void render(Profile profile) const;
 
     void addMember(TargetType type, const String &name, Member *member);
 
+    //! Target type of the members specific to a profile.
+    static TargetType getTarget(Profile profile) { return (TargetType)(profile + 1); }
+
     void write(const String &outPath, const String &hppExt, const String &cppExt);
 
 private:
 
+    //! Owner, for the config, templates, members types and outputs.
+    Generator &m_generator;
+
     //! True mean class composition, False mean inheritance excepted for abstract classes.
     Bool m_composite;
 
@@ -209,10 +277,20 @@ private:
     //! Relative path to the root; with zero, one or more "../"
     String m_relPath;
 
+    //! ${stamp} of the generated files, the date or the hash of the main file.
+    String m_stamp;
+
+    //! True if an exported data has variable length integers (DataEncoding header).
+    Bool m_encoded;
+
+    //! True if an exported data has members of types declared by the DataEncoding header
+    //! (string views, fixed strings), so included by the class headers too.
+    Bool m_encodedTypes;
+
     //! Current input stream of the main parsed file
-    InStream *m_is;
+    TextReader *m_is;
 
-    //! Current target type
+    //! Current target type (parsing only, the render uses the target of its profile)
     TargetType m_currentType;
     //! Content of the current line (can be truncated and optimized)
     String m_currentLine;
@@ -240,58 +318,137 @@ private:
     void addMember(TargetType target, Data *data, Member *member, Member *parent);
 
     //! Parse a file containing class declarations.
-    void parseClassFile(InStream *is, UInt32 importLevel, Int32 pass);
+    void parseClassFile(TextReader *is, UInt32 importLevel, Int32 pass);
     //! Parse a file containing typedef declarations.
-    void parseTypedefFile(InStream *is);
+    void parseTypedefFile(TextReader *is);
 
     //! Import a file containing class declarations.
     void importData(const String &line, UInt32 importLevel, Int32 pass);
     //! Import a file containing typedef declarations.
     void importTypedef(const String &line, Int32 pass);
 
-    void parseTarget(InStream *is, const String &line, Data *data);
-    void parseTypeDef(InStream *is, const String &line, Int32 pass);
-    void parseIdentifier(InStream *is, const String &line, Data *data);
-    void parseData(InStream *is, const String &line, Int32 pass);
-    void parseTemplate(InStream *is, const String &line);
-
-    void parseDataInt(InStream *is, Bool begin, Data *data);
-    void parseDataLoop(InStream *is, const String &line, Data *data, Member *parent);
-    void parseDataIf(InStream *is, const String &line, Data *data, Member *parent);
-    void parseDataMember(InStream *is, const String &line, Data *data, Member *parent);
-    void parseDataArray(InStream *is, const String &line, Data *data, Member *parent);
-    void parseDataConst(InStream *is, const String &line, Data *data, Member *parent, Bool ispublic);
-    void parseDataBit(InStream *is, const String &line, Data *data, Member *parent);
-    void parseDataExtern(InStream *is, const String &line, Data *data, Member *parent);
-    void parseDataStatic(InStream *is, const String &line, Data *data, Member *parent);
+    void parseTarget(TextReader *is, const String &line, Data *data);
+    void parseTypeDef(TextReader *is, const String &line, Int32 pass);
+    void parseIdentifier(TextReader *is, const String &line, Data *data);
+    void parseData(TextReader *is, const String &line, Int32 pass);
+    void parseTemplate(TextReader *is, const String &line);
+
+    void parseDataInt(TextReader *is, Bool begin, Data *data);
+    void parseDataLoop(TextReader *is, const String &line, Data *data, Member *parent);
+    void parseDataIf(TextReader *is, const String &line, Data *data, Member *parent);
+    void parseDataMember(TextReader *is, const String &line, Data *data, Member *parent);
+    void parseDataArray(TextReader *is, const String &line, Data *data, Member *parent);
+    void parseDataConst(TextReader *is, const String &line, Data *data, Member *parent, Bool ispublic);
+    void parseDataBit(TextReader *is, const String &line, Data *data, Member *parent);
+    void parseDataExtern(TextReader *is, const String &line, Data *data, Member *parent);
+    void parseDataStatic(TextReader *is, const String &line, Data *data, Member *parent);
 
     //! Parse @annotations
-    void parseAnnotation(InStream *is, const String &line, Data *data);
+    void parseAnnotation(TextReader *is, const String &line, Data *data);
+
+    void writeDataReaderClass(const String &outPath, const String &hppExt, Profile profile) const;
+    void writeDataReaderImpl(const String &outPath, const String &cppExt, Profile profile, Bool templates) const;
 
-    void writeDataReaderClass(const String &outPath, const String &hppExt, Profile profile);
-    void writeDataReaderImpl(const String &outPath, const String &cppExt, Profile profile);
+    void writeDataReaderClassContent(TextBuffer *os, Data *data, Profile profile) const;
+    void writeDataReaderImplContent(TextBuffer *os, Data *data, Profile profile) const;
 
-    void writeDataReaderClassContent(OutStream *os, Data *data, Profile profile);
-    void writeDataReaderImplContent(OutStream *os, Data *data, Profile profile);
+    void writeDataReaderUserImpl(const String &outPath, const String &cppExt, Profile profile, Bool templates) const;
+    void writeDataReaderUserImplContent(TextBuffer *os, Data *data, Profile profile) const;
 
-    void writeDataReaderUserImpl(const String &outPath, const String &cppExt, Profile profile);
-    void writeDataReaderUserImplContent(OutStream *os, Data *data, Profile profile);
+    void writeDataWriterClass(const String &outPath, const String &hppExt, Profile profile) const;
+    void writeDataWriterImpl(const String &outPath, const String &cppExt, Profile profile, Bool templates) const;
 
-    void writeDataWriterClass(const String &outPath, const String &hppExt, Profile profile);
-    void writeDataWriterImpl(const String &outPath, const String &cppExt, Profile profile);
+    void writeDataWriterClassContent(TextBuffer *os, Data *data, Profile profile) const;
+    void writeDataWriterImplContent(TextBuffer *os, Data *data, Profile profile) const;
 
-    void writeDataWriterClassContent(OutStream *os, Data *data, Profile profile);
-    void writeDataWriterImplContent(OutStream *os, Data *data, Profile profile);
+    //! Benchmark functions of the data, encode for the editor, decode for the others.
+    void writeDataBench(const String &outPath, const String &cppExt, Profile profile) const;
+    void writeDataBenchContent(TextBuffer *os, Data *data, Profile profile) const;
+
+    //! Output file name into the sub-folder of this file (if any).
+    String getOutFileName(const String &outPath, const String &name) const;
 
     //! Replace variables with their related content "${VarName}"
     void parseVariable(String &outLine,
             Data *data,
             const String &header,
             const String &classSuffix,
-            Profile profile);
+            Profile profile) const;
 
     //! Update headers as necessary (no doubled), for a specific target, and a target file type.
-    void updateHeader(const T_StringList &headers, FileType fileType);
+    void updateHeader(TargetType target, const T_StringList &headers, FileType fileType);
+
+    //! True if the data is a template generated as a C++ class template (templates.explicit).
+    Bool isExplicitTemplate(const Data *data) const;
+
+    //! True if the data is implemented by this file, into the templates implementation or not.
+    Bool isImplemented(const Data *data, Bool templates) const;
+
+    //! Template declaration of an explicit template data, "template <o3d::Int32 A, ...>".
+    String getTemplateDecl(const Data *data) const;
+
+    //! Generated class of a data, with its template arguments if an explicit template.
+    String getDataClass(const Data *data) const;
+
+    //! Generated base class of a data, with its template values if an explicit template.
+    //! Empty if no inheritance.
+    String getBaseClass(const Data *data) const;
+
+    //! True if the batch of records of a data is written by columns : no base class,
+    //! and only members with a column (@see Member::Column) for the profile.
+    Bool isColumnar(const Data *data, Profile profile) const;
+
+    //! True if the data, its base or a data of its members has string views for the
+    //! profile, then it is read from a DataMemoryInStream only.
+    Bool isViewed(const Data *data, Profile profile) const;
+
+    //! Same, the visited data are skipped (a data having an array of itself).
+    Bool isViewed(const Data *data, Profile profile, std::vector<const Data*> &visited) const;
+
+    //! True if the members or a data of the members have string views.
+    Bool isViewed(const T_MemberList &members, Profile profile,
+                  std::vector<const Data*> &visited) const;
+
+    //! Body of writeBatch, by columns or by rows.
+    void writeBatchWrite(TextBuffer *os, const Data *data, Profile profile) const;
+
+    //! Body of readBatch, the rows are always accepted, the columns if isColumnar.
+    void writeBatchRead(TextBuffer *os, const Data *data, Profile profile) const;
+
+    //! Read of the base class and the members, with the string table if pack.strings.
+    void writeReadMembers(TextBuffer *os, const Data *data, Profile profile) const;
+
+    //! Write of the base class and the members, with the string table if pack.strings.
+    void writeWriteMembers(TextBuffer *os, const Data *data, Profile profile) const;
+
+    //! Body of reset, the base class, the members, then the initializers as the constructor.
+    void writeReset(TextBuffer *os, const Data *data, Profile profile) const;
+
+    //! Write the template declaration of an explicit template data, and for a class
+    //! header the extern declaration of its base class template specialization.
+    void writeTemplateDecl(TextBuffer *os, const Data *data, Profile profile, Bool header) const;
+
+    //! Register the explicit template data implemented into a file of this data file.
+    void registerTemplateFile(Profile profile, const String &name) const;
+
+    //! Direct includes of the generated header of a profile.
+    HeaderFanOut getHeaderFanOut(const String &filename, Profile profile) const;
+
+    //! Include path of a runtime header of a profile (DataBench, DataEncoding), from
+    //! the implementations of this file.
+    String getRuntimeHeader(const String &name, Profile profile) const;
+
+    //! Data file relative to the input, without extension (pkg/Model).
+    String getSourceName() const;
+
+    //! Write a generated file to the output sink, and count it for the stats and the report.
+    void writeOutput(const String &filename, TextBuffer &&buffer, Profile profile) const;
+
+    //! Members, includes and inheritance of the exported data, for the report (--report).
+    DataReport getReport(Profile profile) const;
+
+    //! Find the header of an imported data, relative to this file.
+    void findImportHeader(const String &data, T_StringList &headers) const;
 
     //! Update class predeclaration (no doubled).
     void updateClasses(const String &classname);
@@ -0,0 +1,155 @@
+/**
+ * @file fileprovider.cpp
+ * @brief Sources and generated files on the file system, for the command line tool.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "fileprovider.h"
+
+#include <o3d/core/debug.h>
+#include <o3d/core/filemanager.h>
+#include <o3d/core/localdir.h>
+#include <o3d/core/localfile.h>
+#include <o3d/core/smartpointer.h>
+
+#include <vector>
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+void FileSourceProvider::read(const String &filename, T_StringList &lines)
+{
+    AutoPtr<InStream> is(FileManager::instance()->openInStream(filename));
+
+    String line;
+    while (is->readLine(line) != EOF)
+    {
+        lines.push_back(line);
+    }
+}
+
+void FileSourceProvider::list(const String &path, const T_StringList &exts, T_StringList &names)
+{
+    String filter;
+    for (const String &ext : exts)
+    {
+        if (filter.isValid())
+            filter += "|";
+
+        filter += "*." + ext;
+    }
+
+    browseFolder(path, "", filter, names);
+}
+
+void FileSourceProvider::browseFolder(
+        const String &root,
+        const String &path,
+        const String &exts,
+        T_StringList &names)
+{
+    FileListing files;
+    files.setPath(path.isValid() ? root + "/" + path : root);
+    files.setExt(exts);
+    files.searchFirstFile();
+
+    FLItem *fl;
+    while ((fl = files.searchNextFile()) != nullptr)
+    {
+        if (fl->FileType == FILE_FILE)
+        {
+            names.push_back(path.isValid() ? path + "/" + fl->FileName : fl->FileName);
+        }
+        else if (fl->FileType == FILE_DIR)
+        {
+            // we want only a relative directory
+            if (!fl->FileName.startsWith("."))
+                browseFolder(root, path.isValid() ? path + "/" + fl->FileName : fl->FileName, exts, names);
+        }
+    }
+}
+
+Bool FileOutputSink::exists(const String &filename)
+{
+    LocalFile fileInfo(filename);
+    return fileInfo.exists();
+}
+
+void FileOutputSink::write(const String &filename, TextBuffer content)
+{
+    String name, path;
+    FileManager::getFileNameAndPath(filename, name, path);
+    path.trimRight('/');
+
+    // the missing folders up to a known or an existing one, then created from the top
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::vector<String> missing;
+        String folder = path;
+
+        while (folder.isValid() && m_folders.find(folder) == m_folders.end() && !LocalDir(folder).exists())
+        {
+            missing.push_back(folder);
+
+            Int32 pos = folder.reverseFind('/');
+            folder = pos > 0 ? folder.sub(0, pos) : String();
+        }
+
+        for (auto it = missing.rbegin(); it != missing.rend(); ++it)
+        {
+            Int32 pos = it->reverseFind('/');
+
+            LocalDir parent(pos > 0 ? it->sub(0, pos) : String(pos == 0 ? "/" : "."));
+            parent.makeDir(it->sub(pos + 1, -1));
+        }
+
+        m_folders.insert(path);
+    }
+
+    AutoPtr<FileOutStream> os(FileManager::instance()->openOutStream(
+                                  FileManager::instance()->getFullFileName(filename),
+                                  FileOutStream::CREATE));
+
+    for (const String &line : content.getLines())
+    {
+        os->writeLine(line);
+    }
+}
+
+Bool FileOutputSink::isSame(const String &filename, const TextBuffer &content)
+{
+    LocalFile fileInfo(filename);
+    if (!fileInfo.exists())
+        return False;
+
+    AutoPtr<InStream> is(FileManager::instance()->openInStream(filename));
+
+    String line;
+    for (const String &contentLine : content.getLines())
+    {
+        if (is->readLine(line) == EOF || line != contentLine)
+            return False;
+    }
+
+    // nothing more
+    return is->readLine(line) == EOF;
+}
+
+void FileOutputSink::read(const String &filename, T_StringList &lines)
+{
+    LocalFile fileInfo(filename);
+    if (!fileInfo.exists())
+        O3D_ERROR(E_InvalidParameter("Unknown output " + filename));
+
+    AutoPtr<InStream> is(FileManager::instance()->openInStream(filename));
+
+    String line;
+    while (is->readLine(line) != EOF)
+    {
+        lines.push_back(line);
+    }
+}
@@ -0,0 +1,64 @@
+/**
+ * @file fileprovider.h
+ * @brief Sources and generated files on the file system, for the command line tool.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _O3D_DMG_FILEPROVIDER_H
+#define _O3D_DMG_FILEPROVIDER_H
+
+#include "provider.h"
+
+#include <mutex>
+#include <set>
+
+namespace o3d {
+namespace dmg {
+
+/**
+ * @brief Read the sources and templates from files.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class FileSourceProvider : public SourceProvider
+{
+public:
+
+    virtual void read(const String &filename, T_StringList &lines) override;
+    virtual void list(const String &path, const T_StringList &exts, T_StringList &names) override;
+
+private:
+
+    void browseFolder(const String &root, const String &path, const String &exts, T_StringList &names);
+};
+
+/**
+ * @brief Write the generated files, creating the sub-folders as necessary.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class FileOutputSink : public OutputSink
+{
+public:
+
+    virtual Bool exists(const String &filename) override;
+    virtual void write(const String &filename, TextBuffer content) override;
+    virtual Bool isSame(const String &filename, const TextBuffer &content) override;
+    virtual void read(const String &filename, T_StringList &lines) override;
+
+private:
+
+    //! Only the folders creation is serialized.
+    std::mutex m_mutex;
+
+    //! Folders known to exist, checked or created once.
+    std::set<String> m_folders;
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_FILEPROVIDER_H
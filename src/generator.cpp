@@ -0,0 +1,1288 @@
+/**
+ * @file generator.cpp
+ * @brief Data model generator, from sources to generated files.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "generator.h"
+#include "asyncoutput.h"
+#include "renderpool.h"
+
+#include <o3d/core/debug.h>
+#include <o3d/core/date.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+static const UInt32 SHARD_VERSION = 1;
+
+static const char* templateFileNames[Generator::NUM_TEMPLATE_TYPE] = {
+    "license.template",
+    "hpp.template",
+    "cpp.template",
+    "data.reader.class.template",
+    "data.writer.class.template",
+    "data.reader.user.impl.template",
+    "data.reader.impl.template",
+    "data.writer.impl.template",
+    "encoding.hpp.template",
+    "bench.hpp.template",
+    "bench.cpp.template",
+    "bench.main.template",
+    "data.bench.encode.template",
+    "data.bench.decode.template",
+    "pack.hpp.template"
+};
+
+Generator::Generator(SourceProvider &sources, OutputSink &output) :
+    m_sources(sources),
+    m_output(output),
+    m_sink(&output),
+    m_composite(False),
+    m_typeDefExt("dtg"),
+    m_classExt("dmg"),
+    m_hppExt("h"),
+    m_cppExt("cpp"),
+    m_version(1),
+    m_benchmark(False),
+    m_pack(False),
+    m_packStrings(False),
+    m_arena(False),
+    m_pool(False),
+    m_jobs(std::thread::hardware_concurrency()),
+    m_explicitTemplates(False),
+    m_fanOutReport(False),
+    m_report(False),
+    m_unity(False),
+    m_unityBudget(512*1024),
+    m_messageId(0),
+    m_reproducible(False),
+    m_shardIndex(0),
+    m_shardCount(1)
+{
+    m_build[DataFile::DISPLAYER] = m_build[DataFile::AUTHORITY] = m_build[DataFile::EDITOR] = True;
+    m_encoding[DataFile::DISPLAYER] = m_encoding[DataFile::AUTHORITY] = m_encoding[DataFile::EDITOR] = False;
+
+    Date date(True);
+    m_year = date.buildString("%y");
+    m_month = date.buildString("%M");
+    m_day = date.buildString("%D");
+}
+
+Generator::~Generator()
+{
+}
+
+void Generator::readConfig(const T_StringList &lines)
+{
+    Int32 equalPos;
+    String key, value;
+
+    for (String line : lines)
+    {
+        line.trimLeftChars(" \t");
+        line.trimRightChars(" \t");
+
+        // comment or empty line
+        if (line.startsWith("#") || line.isEmpty())
+            continue;
+
+        // find the first = and split at
+        equalPos = line.find('=');
+        if (equalPos > 0)
+        {
+            key = line.sub(0, equalPos);
+            key.trimRight(' ');
+
+            value = line.sub(equalPos+1, -1);
+            value.trimLeft(' ');
+
+            setConfig(key, value);
+        }
+    }
+}
+
+void Generator::setConfig(const String &key, const String &value)
+{
+    if (key == "author")
+        m_author = value;
+    else if (key == "displayer.namespace")
+        m_namespace[DataFile::DISPLAYER] = value;
+    else if (key == "authority.namespace")
+        m_namespace[DataFile::AUTHORITY] = value;
+    else if (key == "editor.namespace")
+        m_namespace[DataFile::EDITOR] = value;
+    else if (key == "input")
+        m_inPath = value;
+
+    // unified outputs folders
+    else if (key == "displayer.output")
+        m_outPath[0][DataFile::DISPLAYER] = m_outPath[1][DataFile::DISPLAYER] = value;
+    else if (key == "authority.output")
+        m_outPath[0][DataFile::AUTHORITY] = m_outPath[1][DataFile::AUTHORITY] = value;
+    else if (key == "editor.output")
+        m_outPath[0][DataFile::EDITOR] = m_outPath[1][DataFile::EDITOR] = value;
+    // distincts headers folders
+    else if (key == "displayer.output.headers")
+        m_outPath[0][DataFile::DISPLAYER] = value;
+    else if (key == "authority.output.headers")
+        m_outPath[0][DataFile::AUTHORITY] = value;
+    else if (key == "editor.output.headers")
+        m_outPath[0][DataFile::EDITOR] = value;
+    // distincts sources folders
+    else if (key == "displayer.output.sources")
+        m_outPath[1][DataFile::DISPLAYER] = value;
+    else if (key == "authority.output.sources")
+        m_outPath[1][DataFile::AUTHORITY] = value;
+    else if (key == "editor.output.sources")
+        m_outPath[1][DataFile::EDITOR] = value;
+    // include folders
+    else if (key == "displayer.output.includes")
+        m_outPath[2][DataFile::DISPLAYER] = value;
+    else if (key == "authority.output.includes")
+        m_outPath[2][DataFile::AUTHORITY] = value;
+    else if (key == "editor.output.includes")
+        m_outPath[2][DataFile::EDITOR] = value;
+
+    else if (key == "export")
+    {
+        // any combination of displayer, authority and editor, or any
+        Bool any = value.sub("any", 0) != -1;
+
+        m_build[DataFile::DISPLAYER] = any || value.sub("displayer", 0) != -1;
+        m_build[DataFile::AUTHORITY] = any || value.sub("authority", 0) != -1;
+        m_build[DataFile::EDITOR] = any || value.sub("editor", 0) != -1;
+    }
+    else if (key == "jobs")
+        setJobs(value.toUInt32());
+    else if (key == "templates")
+        m_tplPath = value;
+    else if (key == "version")
+        m_version = value.toUInt32();
+    else if (key == "hppext")
+        m_hppExt = value;
+    else if (key == "cppext")
+        m_cppExt = value;
+    else if (key == "benchmark")
+        m_benchmark = value == "true";
+    else if (key == "pack")
+        m_pack = value == "true";
+    else if (key == "pack.strings")
+        m_packStrings = value == "true";
+    else if (key == "arena")
+        m_arena = value == "true";
+    else if (key == "pool")
+        m_pool = value == "true";
+    else if (key == "templates.explicit")
+        m_explicitTemplates = value == "true";
+    else if (key == "unity")
+        m_unity = value == "true";
+    else if (key == "unity.budget")
+        m_unityBudget = value.toUInt32() * 1024;
+    else if (key == "xref")
+        m_xrefFile = value;
+    else if (key == "reproducible")
+        setReproducible(value == "true");
+}
+
+const char* Generator::getTemplateFileName(TemplateType type)
+{
+    return templateFileNames[type];
+}
+
+void Generator::readTemplates()
+{
+    StatsScope scope(m_stats, "Generator::readTemplates", "<config>", Stats::PHASE_LOAD);
+
+    for (UInt32 t = 0; t < NUM_TEMPLATE_TYPE; ++t)
+    {
+        // the benchmark templates are only necessary when generating the benchmark
+        if (t >= TPL_BENCH_HPP && t <= TPL_DATA_BENCH_DECODE && !m_benchmark)
+            continue;
+
+        if (t == TPL_PACK_HPP && !m_pack)
+            continue;
+
+        m_templates[t].clear();
+        m_sources.read(m_tplPath + "/" + templateFileNames[t], m_templates[t]);
+
+        TextReader reader(m_templates[t]);
+        m_stats.addBytesRead("<config>", reader.getSize());
+    }
+}
+
+void Generator::setTemplate(TemplateType type, const T_StringList &lines)
+{
+    m_templates[type] = lines;
+}
+
+void Generator::run()
+{
+    StatsScope scope(m_stats, "Generator::run", "", Stats::PHASE_NONE);
+
+    T_StringList exts;
+    exts.push_back(m_classExt);
+    exts.push_back(m_typeDefExt);
+
+    // any found data files, in a stable order whatever the file system
+    T_StringList names;
+    m_sources.list(m_inPath, exts, names);
+    names.sort();
+
+    // the whole tree is indexed, even by a shard, because the ids come from every
+    // declaration. the parse of each generated file updates its entries
+    scanSources();
+    assignDataIds();
+
+    generate(names);
+
+    // the files depending on every data file are written by the merge
+    if (m_shardCount > 1)
+    {
+        writeShard();
+        return;
+    }
+
+    writeEncoding();
+
+    if (m_pack)
+        writePack();
+
+    if (m_benchmark)
+        writeBench();
+
+    if (m_explicitTemplates)
+        writeTemplates();
+
+    if (m_unity)
+        writeUnity();
+
+    writeXRef();
+}
+
+void Generator::run(const T_StringList &names)
+{
+    StatsScope scope(m_stats, "Generator::run", "", Stats::PHASE_NONE);
+
+    // from the loaded index, as a full run would
+    assignDataIds();
+
+    generate(names);
+
+    // only if a regenerated file uses it, else it is already up to date
+    writeEncoding();
+    writeXRef();
+}
+
+UInt32 Generator::mergeShards()
+{
+    StatsScope scope(m_stats, "Generator::mergeShards", "<shard>", Stats::PHASE_LOAD);
+
+    // the count of shards is given by the first fragment
+    UInt32 count = 1;
+    std::map<UInt32, String> dataById;
+
+    m_dataIds.clear();
+
+    for (UInt32 i = 0; i < count; ++i)
+    {
+        String filename = getShardFileName(i);
+        if (filename.isEmpty() || !m_output.exists(filename))
+            O3D_ERROR(E_InvalidFormat(String::print("Missing manifest of the shard %u ", i) + filename));
+
+        T_StringList lines;
+        m_output.read(filename, lines);
+
+        TextReader reader(lines);
+        m_stats.addBytesRead("<shard>", reader.getSize());
+
+        Bool version = False;
+        Bool header = False;
+
+        for (String line : lines)
+        {
+            line.trimLeftChars(" \t");
+            line.trimRightChars(" \t");
+
+            if (line.isEmpty() || line.startsWith("#"))
+                continue;
+
+            // the last field is the rest of the line (a specialization can have spaces)
+            Int32 pos = line.find(' ');
+            String key = line.sub(0, pos);
+            String value = pos > 0 ? line.sub(pos + 1, -1) : String();
+
+            if (key == "version")
+            {
+                version = value.toUInt32() == SHARD_VERSION;
+                continue;
+            }
+
+            if (!version)
+                O3D_ERROR(E_InvalidFormat("Unknown manifest format " + filename));
+
+            pos = value.find(' ');
+            String first = value.sub(0, pos);
+            String rest = pos > 0 ? value.sub(pos + 1, -1) : String();
+
+            if (key == "shard")
+            {
+                UInt32 index = first.toUInt32();
+                UInt32 shards = rest.toUInt32();
+
+                if (i == 0)
+                    count = shards > 0 ? shards : 1;
+
+                if (index != i || shards != count)
+                    O3D_ERROR(E_InvalidFormat("Manifest from another sharding " + filename));
+
+                header = True;
+                continue;
+            }
+
+            if (!header)
+                O3D_ERROR(E_InvalidFormat("Missing shard header into " + filename));
+
+            if (key == "id")
+            {
+                UInt32 id = first.toUInt32();
+
+                auto it = m_dataIds.find(rest);
+                if (it != m_dataIds.end() && it->second != id)
+                    O3D_ERROR(E_InvalidFormat("Conflicting ids of the data " + rest));
+
+                auto it2 = dataById.find(id);
+                if (it2 != dataById.end() && it2->second != rest)
+                    O3D_ERROR(E_InvalidFormat(String::print("Id %u given to ", id) + it2->second + " and " + rest));
+
+                m_dataIds[rest] = id;
+                dataById[id] = rest;
+                continue;
+            }
+
+            // the registrations of the render jobs, per profile
+            UInt32 p = first.toUInt32();
+            if (p >= 3 || !m_build[p])
+                continue;
+
+            if (key == "bench")
+            {
+                m_benchData[p].push_back(rest);
+            }
+            else if (key == "encoding")
+            {
+                m_encoding[p] = True;
+            }
+            else if (key == "template")
+            {
+                m_templateFiles[p].insert(rest);
+            }
+            else if (key == "instance")
+            {
+                m_instantiations[p].insert(rest);
+            }
+            else if (key == "unity")
+            {
+                // size path name, the root path is a dot
+                pos = rest.find(' ');
+                Int32 pos2 = pos > 0 ? rest.find(' ', pos + 1) : -1;
+                if (pos2 < 0)
+                    O3D_ERROR(E_InvalidFormat("Invalid unity source into " + filename));
+
+                UnitySource source;
+                source.size = rest.sub(0, pos).toUInt32();
+                source.path = rest.sub(pos + 1, pos2);
+                source.name = rest.sub(pos2 + 1, -1);
+
+                if (source.path == ".")
+                    source.path = String();
+
+                if (m_unity)
+                    m_unitySources[p].push_back(source);
+            }
+            else
+            {
+                O3D_ERROR(E_InvalidFormat("Unknown manifest entry " + key + " into " + filename));
+            }
+        }
+
+        if (!header)
+            O3D_ERROR(E_InvalidFormat("Missing shard header into " + filename));
+    }
+
+    // the index is rebuilt from the sources, as by a full run
+    scanSources();
+
+    writeEncoding();
+
+    if (m_pack)
+        writePack();
+
+    if (m_benchmark)
+        writeBench();
+
+    if (m_explicitTemplates)
+        writeTemplates();
+
+    if (m_unity)
+        writeUnity();
+
+    writeXRef();
+
+    return count;
+}
+
+void Generator::scanSources()
+{
+    T_StringList exts;
+    exts.push_back(m_classExt);
+
+    T_StringList names;
+    m_sources.list(m_inPath, exts, names);
+    names.sort();
+
+    m_xref.clear();
+
+    for (const String &name : names)
+    {
+        T_StringList lines;
+        m_sources.read(m_inPath + "/" + name, lines);
+
+        m_xref.scan(name, lines);
+    }
+}
+
+String Generator::getManifestPath() const
+{
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        if (m_build[p] && m_outPath[0][p].isValid())
+            return m_outPath[0][p];
+    }
+
+    return String();
+}
+
+String Generator::getXRefFileName() const
+{
+    if (m_xrefFile == "none")
+        return String();
+
+    if (m_xrefFile.isValid())
+        return m_xrefFile;
+
+    // default next to the headers of the first exported profile
+    String path = getManifestPath();
+    return path.isValid() ? path + "/datamodelgen.xref" : String();
+}
+
+String Generator::getShardFileName(UInt32 index) const
+{
+    String path = getManifestPath();
+    return path.isValid() ? path + String::print("/datamodelgen.shard%u", index) : String();
+}
+
+void Generator::setShard(UInt32 index, UInt32 count)
+{
+    if (count == 0 || index >= count)
+        O3D_ERROR(E_InvalidParameter(String::print("Invalid shard %u/%u", index, count)));
+
+    m_shardIndex = index;
+    m_shardCount = count;
+}
+
+Bool Generator::isInShard(const String &name, UInt32 index, UInt32 count)
+{
+    if (count <= 1)
+        return True;
+
+    // FNV-1a, stable from a machine to another
+    UInt32 h = 2166136261u;
+    for (UInt32 i = 0; i < name.length(); ++i)
+    {
+        h = (h ^ (UInt32)name[i]) * 16777619u;
+    }
+
+    return h % count == index;
+}
+
+void Generator::assignDataIds()
+{
+    m_dataIds.clear();
+    m_linkedIds.clear();
+
+    // sources sorted by name, and their entries by line
+    UInt32 id = 0;
+    for (const std::pair<const String, XRefIndex::T_EntryVector> &source : m_xref.getSources())
+    {
+        for (const XRefIndex::Entry &entry : source.second)
+        {
+            if (entry.kind != XRefIndex::DECLARE || m_dataIds.find(entry.symbol) != m_dataIds.end())
+                continue;
+
+            m_dataIds[entry.symbol] = ++id;
+            m_messageId.forceID(id);
+        }
+    }
+}
+
+void Generator::writeShard()
+{
+    String filename = getShardFileName(m_shardIndex);
+    if (filename.isEmpty())
+        O3D_ERROR(E_InvalidParameter("No exported profile to write the shard manifest"));
+
+    TextBuffer buffer;
+    buffer.writeLine("# datamodelgen shard manifest, combined by dmg merge");
+    buffer.writeLine(String::print("version %u", SHARD_VERSION));
+    buffer.writeLine(String::print("shard %u %u", m_shardIndex, m_shardCount));
+
+    for (const std::pair<const String, UInt32> &id : m_linkedIds)
+    {
+        buffer.writeLine(String::print("id %u ", id.second) + id.first);
+    }
+
+    // registered by the render jobs in any order, written sorted
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        if (!m_build[p])
+            continue;
+
+        m_benchData[p].sort();
+        for (const String &data : m_benchData[p])
+        {
+            buffer.writeLine(String::print("bench %i ", p) + data);
+        }
+
+        if (m_encoding[p])
+            buffer.writeLine(String::print("encoding %i", p));
+
+        for (const String &templateFile : m_templateFiles[p])
+        {
+            buffer.writeLine(String::print("template %i ", p) + templateFile);
+        }
+
+        for (const String &specialization : m_instantiations[p])
+        {
+            buffer.writeLine(String::print("instance %i ", p) + specialization);
+        }
+
+        std::vector<UnitySource> &sources = m_unitySources[p];
+        std::sort(sources.begin(), sources.end(), [] (const UnitySource &a, const UnitySource &b) {
+            return a.path != b.path ? a.path < b.path : a.name < b.name;
+        });
+
+        for (const UnitySource &source : sources)
+        {
+            buffer.writeLine(String::print("unity %i %u ", p, source.size) +
+                             (source.path.isValid() ? source.path : String(".")) + " " + source.name);
+        }
+    }
+
+    writeIfChanged(filename, std::move(buffer), "<shard>");
+}
+
+void Generator::writeXRef()
+{
+    String filename = getXRefFileName();
+    if (filename.isEmpty())
+        return;
+
+    TextBuffer buffer;
+    m_xref.write(buffer);
+
+    writeIfChanged(filename, std::move(buffer), "<xref>");
+}
+
+void Generator::generate(const T_StringList &names)
+{
+    m_stats.markStartup();
+
+    // enabled profiles (export of the config)
+    std::vector<DataFile::Profile> profiles;
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        if (m_build[p])
+            profiles.push_back((DataFile::Profile)p);
+    }
+
+    // with more than one job, the linked files are rendered by the jobs while parsing
+    // the next ones, and the rendered files are written by a dedicated thread
+    Bool pipeline = m_jobs > 1;
+
+    std::unique_ptr<AsyncOutputSink> writer;
+    if (pipeline)
+    {
+        writer.reset(new AsyncOutputSink(m_output, m_stats));
+        m_sink = writer.get();
+    }
+
+    try {
+        RenderPool pool(pipeline ? m_jobs : 0);
+
+        for (const String &name : names)
+        {
+            // stop on a render error, rethrown by wait
+            if (pool.hasFailed())
+                break;
+
+            // the typedef files declare types for any data file, so they are parsed by
+            // every shard, but rendered only by their own
+            Bool owned = isInShard(name, m_shardIndex, m_shardCount);
+            if (!owned && name.endsWith("." + m_classExt))
+                continue;
+
+            // relative directory of the file
+            Int32 pos = name.reverseFind('/');
+            String path = pos > 0 ? name.sub(0, pos) : String();
+
+            // a data file parses its imports itself, so it is ready to render once parsed.
+            // parse and link stay on this thread, in the order of the files, because they
+            // declare the types and attribute the data ids.
+            std::shared_ptr<DataFile> data = std::make_shared<DataFile>(
+                        *this, path, m_inPath + "/" + name, "Data", m_composite);
+
+            if (name.endsWith(".dmg"))
+                data->parseClassFile();
+            else if (name.endsWith(".tdg"))
+                data->parseTypedefFile();
+
+            data->link();
+
+            if (!owned)
+                continue;
+
+            // released by its last render
+            for (DataFile::Profile profile : profiles)
+            {
+                pool.post([data, profile] () { data->render(profile); });
+            }
+        }
+
+        pool.wait();
+
+        if (writer)
+            writer->flush();
+    } catch (...) {
+        m_sink = &m_output;
+        throw;
+    }
+
+    m_sink = &m_output;
+}
+
+UInt32 Generator::getNextDataId()
+{
+    return m_messageId.getID();
+}
+
+UInt32 Generator::getDataId(const String &data)
+{
+    auto it = m_dataIds.find(data);
+    if (it == m_dataIds.end())
+        it = m_dataIds.insert(std::make_pair(data, getNextDataId())).first;
+
+    m_linkedIds[data] = it->second;
+    return it->second;
+}
+
+void Generator::registerDataId(UInt32 dataId)
+{
+    m_messageId.forceID(dataId);
+}
+
+void Generator::setJobs(UInt32 jobs)
+{
+    m_jobs = jobs > 0 ? jobs : 1;
+}
+
+void Generator::registerSource(DataFile::Profile p, const String &path, const String &name, UInt32 size)
+{
+    if (!m_unity)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    UnitySource source;
+    source.path = path;
+    source.name = name;
+    source.size = size;
+
+    m_unitySources[p].push_back(source);
+}
+
+void Generator::registerTemplateFile(DataFile::Profile p, const String &filename)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_templateFiles[p].insert(filename);
+}
+
+void Generator::registerInstantiation(DataFile::Profile p, const String &specialization)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_instantiations[p].insert(specialization);
+}
+
+void Generator::registerHeader(DataFile::Profile p, const HeaderFanOut &fanOut)
+{
+    if (!m_fanOutReport)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_fanOut[p].push_back(fanOut);
+}
+
+void Generator::printFanOut() const
+{
+    if (!m_fanOutReport)
+        return;
+
+    static const char* profileNames[3] = { "displayer", "authority", "editor" };
+
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        if (!m_build[p])
+            continue;
+
+        std::vector<HeaderFanOut> headers = m_fanOut[p];
+        std::sort(headers.begin(), headers.end(), [] (const HeaderFanOut &a, const HeaderFanOut &b) {
+            return a.includes != b.includes ? a.includes > b.includes : a.filename < b.filename;
+        });
+
+        UInt32 includes = 0, models = 0, predecls = 0, cppIncludes = 0;
+
+        System::print("includes models predecls cpp", String("Header fan-out ") + profileNames[p]);
+
+        for (const HeaderFanOut &fanOut : headers)
+        {
+            System::print(String::print("%u %u %u %u", fanOut.includes, fanOut.models, fanOut.predecls, fanOut.cppIncludes),
+                          fanOut.filename);
+
+            includes += fanOut.includes;
+            models += fanOut.models;
+            predecls += fanOut.predecls;
+            cppIncludes += fanOut.cppIncludes;
+        }
+
+        System::print(String::print("%u %u %u %u", includes, models, predecls, cppIncludes), "Total");
+    }
+}
+
+void Generator::registerOutput(
+        DataFile::Profile p,
+        const String &source,
+        const String &filename,
+        const TextBuffer &buffer)
+{
+    if (!m_report)
+        return;
+
+    UInt32 lines = (UInt32)buffer.getLines().size();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    DataReport &report = m_reports[p][source];
+    report.lines += lines;
+    report.bytes += buffer.getSize();
+
+    if (filename.endsWith("." + m_hppExt))
+        report.headerLines += lines;
+}
+
+void Generator::registerReport(DataFile::Profile p, const DataReport &report)
+{
+    if (!m_report || report.data.empty())
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // the sizes are counted by registerOutput
+    DataReport &entry = m_reports[p][report.source];
+
+    UInt32 lines = entry.lines;
+    UInt32 headerLines = entry.headerLines;
+    UInt64 bytes = entry.bytes;
+
+    entry = report;
+    entry.lines = lines;
+    entry.headerLines = headerLines;
+    entry.bytes = bytes;
+}
+
+//! Generated headers transitively included by a source, memoized.
+static const std::set<String>& transitiveIncludes(
+        const String &source,
+        const std::map<String, DataReport> &reports,
+        std::map<String, std::set<String>> &closures)
+{
+    auto it = closures.find(source);
+    if (it != closures.end())
+        return it->second;
+
+    // inserted before the recursion, so an include cycle terminates
+    std::set<String> &closure = closures[source];
+
+    auto report = reports.find(source);
+    if (report == reports.end())
+        return closure;
+
+    for (const String &include : report->second.modelIncludes)
+    {
+        if (include == source)
+            continue;
+
+        closure.insert(include);
+
+        const std::set<String> &sub = transitiveIncludes(include, reports, closures);
+        closure.insert(sub.begin(), sub.end());
+    }
+
+    closure.erase(source);
+    return closure;
+}
+
+void Generator::printReport() const
+{
+    if (!m_report)
+        return;
+
+    static const char* profileNames[3] = { "displayer", "authority", "editor" };
+
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        if (!m_build[p])
+            continue;
+
+        const std::map<String, DataReport> &reports = m_reports[p];
+        std::map<String, std::set<String>> closures;
+
+        struct Row
+        {
+            String source;
+            UInt32 transitive;
+            UInt64 weight;
+        };
+
+        std::vector<Row> rows;
+
+        System::print("lines bytes includes depth members loops ifs refs weight",
+                      String("Report ") + profileNames[p]);
+
+        // sorted by source
+        for (const std::pair<const String, DataReport> &entry : reports)
+        {
+            const DataReport &report = entry.second;
+            if (report.data.empty())
+                continue;
+
+            const std::set<String> &closure = transitiveIncludes(entry.first, reports, closures);
+
+            UInt64 weight = report.lines;
+            for (const String &include : closure)
+            {
+                auto it = reports.find(include);
+                if (it != reports.end())
+                    weight += it->second.headerLines;
+            }
+
+            weight += (UInt64)(report.includes - report.modelIncludes.size()) * EXTERNAL_HEADER_WEIGHT;
+
+            String data;
+            for (const String &name : report.data)
+            {
+                data += data.isValid() ? "," + name : name;
+            }
+
+            System::print(String::print("%u %llu %u %u %u %u %u %u %llu",
+                                        report.lines, (unsigned long long)report.bytes, report.includes,
+                                        report.depth, report.members, report.loops, report.ifs, report.refs,
+                                        (unsigned long long)weight),
+                          entry.first + " (" + data + ")");
+
+            Row row;
+            row.source = entry.first;
+            row.transitive = (UInt32)closure.size();
+            row.weight = weight;
+
+            rows.push_back(row);
+        }
+
+        std::sort(rows.begin(), rows.end(), [] (const Row &a, const Row &b) {
+            if (a.transitive != b.transitive)
+                return a.transitive > b.transitive;
+
+            return a.weight != b.weight ? a.weight > b.weight : a.source < b.source;
+        });
+
+        System::print("transitive includes, weight", String("Heaviest headers ") + profileNames[p]);
+
+        static const size_t NUM_HEAVIEST = 20;
+        for (size_t i = 0; i < rows.size() && i < NUM_HEAVIEST; ++i)
+        {
+            System::print(String::print("%u %llu", rows[i].transitive, (unsigned long long)rows[i].weight),
+                          rows[i].source);
+        }
+    }
+}
+
+void Generator::registerBenchData(DataFile::Profile p, const String &data)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_benchData[p].push_back(data);
+}
+
+void Generator::registerEncoding(DataFile::Profile p)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_encoding[p] = True;
+}
+
+void Generator::setDate(const String &year, const String &month, const String &day)
+{
+    m_year = year;
+    m_month = month;
+    m_day = day;
+}
+
+void Generator::setReproducible(Bool reproducible)
+{
+    m_reproducible = reproducible;
+
+    if (m_reproducible)
+        setDate("1970", "01", "01");
+}
+
+String Generator::getStamp(const String &contentHash) const
+{
+    if (m_reproducible)
+        return contentHash;
+
+    return m_year + "-" + m_month + "-" + m_day;
+}
+
+String Generator::hashContent(const T_StringList &lines)
+{
+    UInt64 h = 14695981039346656037ULL;
+
+    for (const String &line : lines)
+    {
+        for (UInt32 i = 0; i < line.length(); ++i)
+        {
+            h = (h ^ (UInt64)line[i]) * 1099511628211ULL;
+        }
+
+        // end of line
+        h = (h ^ (UInt64)'\n') * 1099511628211ULL;
+    }
+
+    return String::print("%016llx", (unsigned long long)h);
+}
+
+//! Replace the ${name} variables of a line by their value (unknown variables are removed).
+static void replaceVariables(String &outLine, const StringMap<String> &vars)
+{
+    Int32 p1, p2;
+
+    while ((p1 = outLine.sub("${", 0)) != -1)
+    {
+        p2 = outLine.find('}', p1+2);
+
+        if (p2 == -1)
+            O3D_ERROR(E_InvalidFormat("Missing ending bracket } after ${ in template"));
+
+        String varName = outLine.sub(p1+2, p2);
+        outLine.remove(p1, p2-p1+1);
+
+        auto it = vars.find(varName);
+        if (it != vars.end())
+            outLine.insert(it->second, p1);
+    }
+}
+
+void Generator::getRuntimeVars(DataFile::Profile p, const String &stamp, StringMap<String> &vars) const
+{
+    static const char* profileNames[3] = { "displayer", "authority", "editor" };
+
+    String NS = m_namespace[p];
+    NS.upper();
+
+    String HPP = m_hppExt;
+    HPP.upper();
+
+    vars["ns"] = m_namespace[p];
+    vars["NS"] = NS;
+    vars["hpp"] = m_hppExt;
+    vars["HPP"] = HPP;
+    vars["profile"] = profileNames[p];
+    vars["author"] = m_author;
+    vars["yyyy"] = m_year;
+    vars["mm"] = m_month;
+    vars["dd"] = m_day;
+    vars["stamp"] = stamp;
+}
+
+void Generator::writeBench()
+{
+    StatsScope scope(m_stats, "Generator::writeBench", "<bench>", Stats::PHASE_WRITE);
+
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        DataFile::Profile profile = (DataFile::Profile)p;
+        if (!m_build[p])
+            continue;
+
+        // registered by the render jobs, in any order
+        m_benchData[p].sort();
+
+        StringMap<String> vars;
+        getRuntimeVars(profile, getStamp(hashContent(m_benchData[p])), vars);
+
+        writeRuntimeFile(m_outPath[0][p] + "/DataBench." + m_hppExt, m_templates[TPL_BENCH_HPP], vars, profile, "<bench>");
+        writeRuntimeFile(m_outPath[1][p] + "/DataBench." + m_cppExt, m_templates[TPL_BENCH_MAIN], vars, profile, "<bench>");
+    }
+}
+
+void Generator::writeEncoding()
+{
+    StatsScope scope(m_stats, "Generator::writeEncoding", "<encoding>", Stats::PHASE_WRITE);
+
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        DataFile::Profile profile = (DataFile::Profile)p;
+        // the pack streams give the string table of the DataEncoding header, and the
+        // arena and pool types are declared by it, and the bench decodes from its memory stream
+        if (!m_build[p] || (!m_encoding[p] && !m_pack && !m_arena && !m_pool && !m_benchmark))
+            continue;
+
+        StringMap<String> vars;
+        getRuntimeVars(profile, getStamp(hashContent(m_templates[TPL_ENCODING_HPP])), vars);
+
+        writeRuntimeFile(m_outPath[0][p] + "/DataEncoding." + m_hppExt, m_templates[TPL_ENCODING_HPP], vars, profile, "<encoding>");
+    }
+}
+
+void Generator::writePack()
+{
+    StatsScope scope(m_stats, "Generator::writePack", "<pack>", Stats::PHASE_WRITE);
+
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        DataFile::Profile profile = (DataFile::Profile)p;
+        if (!m_build[p])
+            continue;
+
+        StringMap<String> vars;
+        getRuntimeVars(profile, getStamp(hashContent(m_templates[TPL_PACK_HPP])), vars);
+
+        writeRuntimeFile(m_outPath[0][p] + "/DataPack." + m_hppExt, m_templates[TPL_PACK_HPP], vars, profile, "<pack>");
+    }
+}
+
+void Generator::writeRuntimeFile(
+        const String &filename,
+        const T_StringList &lines,
+        const StringMap<String> &vars,
+        DataFile::Profile profile,
+        const String &statsName)
+{
+    TextBuffer buffer;
+
+    for (const String &tplLine : lines)
+    {
+        String outLine = tplLine;
+        Int32 p1;
+        Int32 p2;
+
+        if (outLine.isEmpty())
+            buffer.writeLine("");
+
+        // block
+        else if ((p1 = outLine.sub("@{", 0)) != -1)
+        {
+            p2 = outLine.find('}', p1+2);
+
+            if (p2 == -1)
+                O3D_ERROR(E_InvalidFormat("Missing ending bracket } after @{ in " + statsName + " template"));
+
+            String blockName = outLine.sub(p1+2, p2);
+            if (blockName == "license")
+            {
+                for (const String &line : m_templates[TPL_LICENCE])
+                {
+                    buffer.writeLine(line);
+                }
+            }
+            else if (blockName == "declarations")
+            {
+                for (const String &data : m_benchData[profile])
+                {
+                    buffer.writeLine("void " + data + "DataBench(DataBench &bench);");
+                }
+            }
+            else if (blockName == "calls")
+            {
+                for (const String &data : m_benchData[profile])
+                {
+                    buffer.writeLine("        " + data + "DataBench(bench);");
+                }
+            }
+        }
+        else
+        {
+            // line with 0 or many variables
+            replaceVariables(outLine, vars);
+            buffer.writeLine(outLine);
+        }
+    }
+
+    UInt64 size = buffer.getSize();
+    m_output.write(filename, std::move(buffer));
+    m_stats.addBytesWritten(statsName, size);
+}
+
+void Generator::writeTemplates()
+{
+    StatsScope scope(m_stats, "Generator::writeTemplates", "<templates>", Stats::PHASE_WRITE);
+
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        if (!m_build[p] || m_templateFiles[p].empty())
+            continue;
+
+        TextBuffer buffer;
+        for (const String &line : m_templates[TPL_LICENCE])
+        {
+            buffer.writeLine(line);
+        }
+
+        buffer.writeLine("");
+
+        // the implementations of any class template, because a specialization
+        // can implicitly instantiate its base template with other values
+        for (const String &filename : m_templateFiles[p])
+        {
+            buffer.writeLine("#include \"" + filename + "\"");
+        }
+
+        buffer.writeLine("");
+        buffer.writeLine("namespace " + m_namespace[p] + " {");
+        buffer.writeLine("");
+
+        for (const String &specialization : m_instantiations[p])
+        {
+            buffer.writeLine("template class " + specialization + ";");
+        }
+
+        buffer.writeLine("");
+        buffer.writeLine("} // namespace " + m_namespace[p]);
+
+        String filename = "DataTemplates." + m_cppExt;
+        UInt64 size = buffer.getSize();
+        writeIfChanged(m_outPath[1][p] + "/" + filename, std::move(buffer), "<templates>");
+
+        // a regular source, for the unity files too
+        registerSource((DataFile::Profile)p, "", filename, size);
+    }
+}
+
+void Generator::writeUnity()
+{
+    StatsScope scope(m_stats, "Generator::writeUnity", "<unity>", Stats::PHASE_WRITE);
+
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        if (!m_build[p])
+            continue;
+
+        std::vector<UnitySource> &sources = m_unitySources[p];
+
+        // stable order, whatever the order of the files listing
+        std::sort(sources.begin(), sources.end(), [] (const UnitySource &a, const UnitySource &b) {
+            return a.path != b.path ? a.path < b.path : a.name < b.name;
+        });
+
+        TextBuffer list;
+        list.writeLine("# Generated by datamodelgen, do not edit.");
+        list.writeLine("# Select one of the two sets, the per file or the unity sources.");
+        list.writeLine("");
+        list.writeLine("set(DMG_SOURCES");
+
+        for (const UnitySource &source : sources)
+        {
+            String relName = source.path.isValid() ? source.path + "/" + source.name : source.name;
+            list.writeLine("    ${CMAKE_CURRENT_LIST_DIR}/" + relName);
+        }
+
+        list.writeLine(")");
+        list.writeLine("");
+        list.writeLine("set(DMG_UNITY_SOURCES");
+
+        // group by directory, then a new unity file each time the budget is reached
+        // (a changed file only recompiles its unity file, an added one the following
+        // of its directory)
+        size_t n = 0;
+        while (n < sources.size())
+        {
+            const String &path = sources[n].path;
+
+            String dirName = path;
+            dirName.replace('.', '_');
+
+            UInt32 index = 0;
+            while (n < sources.size() && sources[n].path == path)
+            {
+                TextBuffer unity;
+                unity.writeLine("// Generated by datamodelgen, do not edit.");
+                unity.writeLine("");
+
+                UInt32 size = 0;
+                while (n < sources.size() && sources[n].path == path)
+                {
+                    if (size > 0 && size + sources[n].size > m_unityBudget)
+                        break;
+
+                    String relName = path.isValid() ? path + "/" + sources[n].name : sources[n].name;
+                    unity.writeLine("#include \"" + relName + "\"");
+
+                    // at least one file per unity, even for an unknown size
+                    size += sources[n].size > 0 ? sources[n].size : 1;
+                    ++n;
+                }
+
+                String unityName = dirName.isValid() ?
+                            "unity_" + dirName + String::print("_%u.", index) :
+                            String::print("unity_%u.", index);
+                unityName += m_cppExt;
+
+                writeIfChanged(m_outPath[1][p] + "/" + unityName, std::move(unity), "<unity>");
+                list.writeLine("    ${CMAKE_CURRENT_LIST_DIR}/" + unityName);
+
+                ++index;
+            }
+        }
+
+        list.writeLine(")");
+
+        writeIfChanged(m_outPath[1][p] + "/datamodelgen.cmake", std::move(list), "<unity>");
+    }
+}
+
+void Generator::writeIfChanged(const String &filename, TextBuffer &&buffer, const String &statsName)
+{
+    if (m_output.isSame(filename, buffer))
+    {
+        m_stats.addFileSkipped(statsName);
+        return;
+    }
+
+    UInt64 size = buffer.getSize();
+    m_output.write(filename, std::move(buffer));
+    m_stats.addBytesWritten(statsName, size);
+}
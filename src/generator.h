@@ -0,0 +1,432 @@
+/**
+ * @file generator.h
+ * @brief Data model generator, from sources to generated files.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _O3D_DMG_GENERATOR_H
+#define _O3D_DMG_GENERATOR_H
+
+#include <o3d/core/stringlist.h>
+#include <o3d/core/stringmap.h>
+#include <o3d/core/idmanager.h>
+
+#include "datafile.h"
+#include "memberfactory.h"
+#include "provider.h"
+#include "stats.h"
+#include "xrefindex.h"
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace o3d {
+namespace dmg {
+
+/**
+ * @brief The Generator class, the entry point of the dmg library.
+ * It owns the config, the templates, the data ids, the types declared by the
+ * parsed files and the stats of a project. Sources and templates are read from
+ * a SourceProvider and the generated files are given to an OutputSink, so a
+ * project can be generated from and to memory, and many generators can run
+ * concurrently into the same process (one thread per generator).
+ * With more than one job, a generator pipelines its files : parse and link on the
+ * calling thread, render on the jobs threads, and write on a writer thread.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class Generator
+{
+public:
+
+    enum TemplateType
+    {
+        TPL_LICENCE = 0,
+        TPL_HPP,
+        TPL_CPP,
+        TPL_DATA_READER_CLASS,
+        TPL_DATA_WRITER_CLASS,
+        TPL_DATA_READER_USER_IMPL,
+        TPL_DATA_READER_IMPL,
+        TPL_DATA_WRITER_IMPL,
+        TPL_ENCODING_HPP,
+        TPL_BENCH_HPP,
+        TPL_BENCH_CPP,
+        TPL_BENCH_MAIN,
+        TPL_DATA_BENCH_ENCODE,
+        TPL_DATA_BENCH_DECODE,
+        TPL_PACK_HPP,
+        TPL_LAST = TPL_PACK_HPP
+    };
+
+    static const UInt32 NUM_TEMPLATE_TYPE = TPL_LAST + 1;
+
+    Generator(SourceProvider &sources, OutputSink &output);
+
+    ~Generator();
+
+    //! Read a config (the datamodelgen file content), lines of key = value.
+    void readConfig(const T_StringList &lines);
+
+    //! Set a single config value.
+    void setConfig(const String &key, const String &value);
+
+    //! Read the templates from the templates path of the config, using the source provider.
+    void readTemplates();
+
+    //! Set a template content.
+    void setTemplate(TemplateType type, const T_StringList &lines);
+
+    //! Template file name, relative to the templates path.
+    static const char* getTemplateFileName(TemplateType type);
+
+    //! Parse and generate any data file found into the input path.
+    void run();
+
+    //! Parse and generate only some data files (relative to the input path), for
+    //! the mv command. The unity, templates and benchmark files are not updated.
+    void run(const T_StringList &names);
+
+    /**
+     * @brief Combine the manifest fragments written by each shard, then write the
+     * unity, templates, benchmark and cross-reference files as a full run would.
+     * The fragments are read in the order of the shards, and the written files are
+     * sorted, so the result does not depend on which shard finished first.
+     * @return The number of merged shards.
+     * @throw E_InvalidFormat if a fragment is missing, from another sharding, or if
+     *        two shards attributed different ids to a data.
+     */
+    UInt32 mergeShards();
+
+    //! Build the cross-reference index from the data files, without generating.
+    void scanSources();
+
+    //! Write the cross-reference index if changed (nothing if xref = none).
+    void writeXRef();
+
+    //-----------------------------------------------------------------------------------
+    // Accessors
+    //-----------------------------------------------------------------------------------
+
+    SourceProvider& getSourceProvider() { return m_sources; }
+    //! During run, the writer queue when pipelined, else the output sink.
+    OutputSink& getOutputSink() { return *m_sink; }
+
+    //! Types declared by the parsed files, and builtin types.
+    MemberFactory& getMemberFactory() { return m_memberFactory; }
+
+    void setInPath(const String &path) { m_inPath = path; }
+    const String& getInPath() const { return m_inPath; }
+
+    void setTemplatesPath(const String &path) { m_tplPath = path; }
+    const String& getTemplatesPath() const { return m_tplPath; }
+
+    void setOutPath(DataFile::FileType type, DataFile::Profile p, const String &path) { m_outPath[type][p] = path; }
+
+    const String& getOutHppPath(DataFile::Profile p) const { return m_outPath[0][p]; }
+    const String& getOutCppPath(DataFile::Profile p) const { return m_outPath[1][p]; }
+    const String& getIncludePath(DataFile::Profile p) const { return m_outPath[2][p]; }
+
+    const String& getTypeDefExt() const { return m_typeDefExt; }
+    const String& getClassExt() const { return m_classExt; }
+    const String& getHppExt() const { return m_hppExt; }
+    const String& getCppExt() const { return m_cppExt; }
+
+    const T_StringList& getTemplate(TemplateType type) const { return m_templates[type]; }
+
+    UInt32 getVersion() const { return m_version; }
+
+    UInt32 getNextDataId();
+    void registerDataId(UInt32 dataId);
+
+    /**
+     * @brief Id of a data. Ids are attributed by the run from the declarations of
+     * every data file, in the order of the files names, so they do not depend on the
+     * generated files (sharded or partial runs). An unknown data gets the next free id.
+     */
+    UInt32 getDataId(const String &data);
+
+    /**
+     * @brief Only generate the data files of a partition, given by a hash of their
+     * name, and write a manifest fragment in place of the files depending on every
+     * data file (unity, templates, benchmark, cross-reference), see mergeShards.
+     * The typedef files are parsed by every shard and rendered by their own one.
+     * @param index Zero based index of the shard.
+     * @param count Number of shards, 1 for the whole tree (default).
+     */
+    void setShard(UInt32 index, UInt32 count);
+
+    UInt32 getShardIndex() const { return m_shardIndex; }
+    UInt32 getShardCount() const { return m_shardCount; }
+
+    //! True if a data file (relative to the input path) belongs to a shard.
+    static Bool isInShard(const String &name, UInt32 index, UInt32 count);
+
+    //! Manifest fragment of a shard, next to the cross-reference index.
+    String getShardFileName(UInt32 index) const;
+
+    Bool isBuild(DataFile::Profile p) const { return m_build[p]; }
+
+    //! True if the benchmark sources must be generated (benchmark = true).
+    Bool isBenchmark() const { return m_benchmark; }
+
+    //! True if the pack container runtime must be generated (pack = true).
+    Bool isPack() const { return m_pack; }
+
+    //! True if the loops and the custom arrays are allocated by the DataArena of the
+    //! DataEncoding header (arena = true).
+    Bool isArena() const { return m_arena; }
+
+    //! True if the reader classes get a DataPool typedef (pool = true).
+    Bool isPool() const { return m_pool; }
+
+    //! True if the string members are written into the string table of the packs
+    //! (pack = true and pack.strings = true).
+    Bool isPackStrings() const { return m_pack && m_packStrings; }
+
+    //! True if the template data are generated as C++ class templates, explicitly
+    //! instantiated once (templates.explicit = true).
+    Bool isExplicitTemplates() const { return m_explicitTemplates; }
+
+    //! Register an implementation file of class templates (relative to the sources output).
+    //! Called by the render jobs.
+    void registerTemplateFile(DataFile::Profile p, const String &filename);
+
+    //! Register a used specialization of a class template (as "FooData<1>").
+    void registerInstantiation(DataFile::Profile p, const String &specialization);
+
+    //! True if the amalgamated sources must be generated (unity = true).
+    Bool isUnity() const { return m_unity; }
+
+    //! Register a generated implementation file of a data file, for the unity files.
+    //! Called by the render jobs.
+    //! @param path Relative directory of the data file.
+    //! @param name File name into this directory.
+    //! @param size Generated size in bytes (0 if not known, for an existing user file).
+    void registerSource(DataFile::Profile p, const String &path, const String &name, UInt32 size);
+
+    //! Collect the includes of the generated headers, for printFanOut (--fanout).
+    void setFanOutReport(Bool enabled) { m_fanOutReport = enabled; }
+    Bool isFanOutReport() const { return m_fanOutReport; }
+
+    //! Called by the render jobs.
+    void registerHeader(DataFile::Profile p, const HeaderFanOut &fanOut);
+
+    //! Print the headers per profile, from the most to the least included.
+    void printFanOut() const;
+
+    //! Collect the size and compile cost of the generated files, for printReport (--report).
+    void setReport(Bool enabled) { m_report = enabled; }
+    Bool isReport() const { return m_report; }
+
+    //! Count a generated file of a data file (source relative to the input, without
+    //! extension). Called by the render jobs.
+    void registerOutput(DataFile::Profile p, const String &source, const String &filename, const TextBuffer &buffer);
+
+    //! Called by the render jobs, once the files of a data file are written.
+    void registerReport(DataFile::Profile p, const DataReport &report);
+
+    /**
+     * @brief Print per profile a row per data file (generated lines and bytes, includes,
+     * inheritance depth, members, loops, ifs, custom refs and estimated compile weight),
+     * then the heaviest headers by transitive include count.
+     * The compile weight is in lines : the generated lines, the lines of the generated
+     * headers transitively included, and EXTERNAL_HEADER_WEIGHT per other direct include.
+     */
+    void printReport() const;
+
+    //! Estimated lines of an external (o3d or standard) header, for the compile weight.
+    static const UInt32 EXTERNAL_HEADER_WEIGHT = 2000;
+
+    //! Number of threads rendering the parsed files (default is the number of cores).
+    //! With 1 everything is done by the thread of run, one file after another.
+    void setJobs(UInt32 jobs);
+    UInt32 getJobs() const { return m_jobs; }
+
+    //! Register a data having benchmark functions, for the benchmark driver.
+    //! Called by the render jobs.
+    void registerBenchData(DataFile::Profile p, const String &data);
+
+    //! Register a profile having variable length integers, for the DataEncoding header.
+    //! Called by the render jobs.
+    void registerEncoding(DataFile::Profile p);
+
+    const String& getNamespace(DataFile::Profile p) const { return m_namespace[p]; }
+    const String& getAuthor() const { return m_author; }
+
+    //! Date written into the generated files (default is today).
+    void setDate(const String &year, const String &month, const String &day);
+
+    /**
+     * @brief Reproducible outputs (reproducible = true) : the date is fixed to
+     * 1970-01-01, and the ${stamp} of a generated file is the hash of its source
+     * in place of the date, so identical sources give byte-identical files on any
+     * machine, any day, and the compiler caches hit.
+     */
+    void setReproducible(Bool reproducible);
+    Bool isReproducible() const { return m_reproducible; }
+
+    /**
+     * @brief Value of the ${stamp} variable of a generated file.
+     * @param contentHash Hash of the source of the file (@see hashContent).
+     * @return The hash if reproducible, else the date (yyyy-mm-dd).
+     */
+    String getStamp(const String &contentHash) const;
+
+    //! 64 bits FNV-1a of lines, as 16 hexadecimal digits.
+    static String hashContent(const T_StringList &lines);
+
+    const String& getYear() const { return m_year; }
+    const String& getMonth() const { return m_month; }
+    const String& getDay() const { return m_day; }
+
+    //! Phases timing and trace events.
+    Stats& getStats() { return m_stats; }
+
+    //! Symbols declared and referenced by the data files, updated by their parse.
+    XRefIndex& getXRefIndex() { return m_xref; }
+
+    //! Persisted cross-reference index (xref), default is datamodelgen.xref into the
+    //! headers output of the first exported profile. Empty if disabled (xref = none).
+    String getXRefFileName() const;
+    void setXRefFileName(const String &filename) { m_xrefFile = filename; }
+
+private:
+
+    SourceProvider &m_sources;
+    OutputSink &m_output;
+    OutputSink *m_sink;
+
+    //! Registrations from the render jobs.
+    std::mutex m_mutex;
+
+    MemberFactory m_memberFactory;
+
+    Bool m_composite;
+
+    String m_inPath;
+    String m_tplPath;
+    String m_outPath[3][3];
+
+    String m_typeDefExt;
+    String m_classExt;
+    String m_hppExt;
+    String m_cppExt;
+
+    UInt32 m_version;
+
+    Bool m_build[3];
+
+    Bool m_benchmark;
+    T_StringList m_benchData[3];
+
+    Bool m_encoding[3];     //!< profiles including the DataEncoding header
+
+    Bool m_pack;
+    Bool m_packStrings;
+
+    Bool m_arena;
+    Bool m_pool;
+
+    UInt32 m_jobs;
+
+    struct UnitySource
+    {
+        String path;
+        String name;
+        UInt32 size;
+    };
+
+    Bool m_explicitTemplates;
+    std::set<String> m_templateFiles[3];
+    std::set<String> m_instantiations[3];
+
+    Bool m_fanOutReport;
+    std::vector<HeaderFanOut> m_fanOut[3];
+
+    Bool m_report;
+    std::map<String, DataReport> m_reports[3];   //!< per source
+
+    Bool m_unity;
+    UInt32 m_unityBudget;   //!< in bytes of generated code per unity file
+    std::vector<UnitySource> m_unitySources[3];
+
+    IDManager m_messageId;
+
+    T_StringList m_templates[NUM_TEMPLATE_TYPE];
+
+    String m_namespace[3];
+    String m_author;
+
+    String m_year;
+    String m_month;
+    String m_day;
+
+    Bool m_reproducible;
+
+    Stats m_stats;
+
+    XRefIndex m_xref;
+    String m_xrefFile;
+
+    UInt32 m_shardIndex;
+    UInt32 m_shardCount;
+
+    //! Ids attributed from the declarations, and the ones given to the linked data.
+    std::map<String, UInt32> m_dataIds;
+    std::map<String, UInt32> m_linkedIds;
+
+    //! Folder of the generator files (index, fragments), the headers output of the
+    //! first exported profile.
+    String getManifestPath() const;
+
+    //! Attribute an id to each data declared into the cross-reference index.
+    void assignDataIds();
+
+    //! Write the manifest fragment of this shard.
+    void writeShard();
+
+    //! Parse and render the data files, pipelined with more than one job.
+    void generate(const T_StringList &names);
+
+    //! Write the benchmark runtime header and driver of each profile.
+    void writeBench();
+
+    //! Write the variable length integers header of the profiles using it.
+    void writeEncoding();
+
+    //! Write the pack container runtime header of each profile.
+    void writePack();
+
+    //! Variables of the runtime files of a profile (namespace, extension, author, date).
+    void getRuntimeVars(DataFile::Profile p, const String &stamp, StringMap<String> &vars) const;
+
+    //! Write a runtime file of a profile from its template (bench, encoding, pack).
+    void writeRuntimeFile(
+            const String &filename,
+            const T_StringList &lines,
+            const StringMap<String> &vars,
+            DataFile::Profile profile,
+            const String &statsName);
+
+    //! Write the explicit instantiations of the used class templates specializations
+    //! of each profile, into a single DataTemplates source including their implementations.
+    void writeTemplates();
+
+    //! Write the unity files of each profile, grouping the implementations by
+    //! directory and size budget, and the CMake lists of both sources sets.
+    void writeUnity();
+
+    //! Write a generated file only if its content changed, to keep its timestamp.
+    void writeIfChanged(const String &filename, TextBuffer &&buffer, const String &statsName);
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_GENERATOR_H
@@ -8,344 +8,538 @@
  */
 
 #include <o3d/core/architecture.h>
+#ifndef DMG_HEADLESS
 #include <o3d/core/main.h>
+#endif
 #include <o3d/core/localdir.h>
 #include <o3d/core/filemanager.h>
 #include <o3d/core/stringtokenizer.h>
 #include <o3d/core/smartpointer.h>
 
 #include "main.h"
-#include "datafile.h"
-#include "memberfactory.h"
+
+#include <memory>
+#include <thread>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-Main *Main::ms_instance;
-
-Main *Main::instance()
+Main::Main() :
+    m_jobs(0),
+    m_shardIndex(0),
+    m_shardCount(1),
+    m_shards(0),
+    m_reproducible(False),
+    m_generator(m_sources, m_output)
 {
-    return ms_instance;
 }
 
-Main::Main() :
-    m_composite(False),
-    m_typeDefExt("dtg"),
-    m_classExt("dmg"),
-    m_hppExt("h"),
-    m_cppExt("cpp"),
-    m_version(1),
-    m_messageId(0)
+Main::~Main()
 {
-    ms_instance = this;
 }
 
-Main::~Main()
+void Main::parseArgs(const T_StringList &args)
 {
-    ms_instance = nullptr;
+    m_args.clear();
+
+    Bool trace = False;
+    Bool jobs = False;
+    Bool shard = False;
+    Bool shards = False;
+    for (const String &arg : args)
+    {
+        if (trace)
+        {
+            m_generator.getStats().setTraceFile(FileManager::instance()->getFullFileName(arg));
+            trace = False;
+        }
+        else if (jobs)
+        {
+            m_jobs = arg.toUInt32();
+            if (m_jobs == 0)
+                O3D_ERROR(E_InvalidParameter("Invalid number of jobs " + arg));
+
+            jobs = False;
+        }
+        else if (shard)
+        {
+            // i/N
+            Int32 pos = arg.find('/');
+            m_shardIndex = pos > 0 ? arg.sub(0, pos).toUInt32() : 0;
+            m_shardCount = pos > 0 ? arg.sub(pos + 1, -1).toUInt32() : 0;
+
+            if (pos <= 0 || m_shardCount == 0 || m_shardIndex >= m_shardCount)
+                O3D_ERROR(E_InvalidParameter("Invalid shard " + arg + ", expected index/count"));
+
+            shard = False;
+        }
+        else if (shards)
+        {
+            m_shards = arg.toUInt32();
+            if (m_shards == 0)
+                O3D_ERROR(E_InvalidParameter("Invalid number of shards " + arg));
+
+            shards = False;
+        }
+        else if (arg == "--stats")
+            m_generator.getStats().setEnabled(True);
+        else if (arg == "--trace")
+            trace = True;
+        else if (arg == "--jobs")
+            jobs = True;
+        else if (arg == "--fanout")
+            m_generator.setFanOutReport(True);
+        else if (arg == "--shard")
+            shard = True;
+        else if (arg == "--shards")
+            shards = True;
+        else if (arg == "--reproducible")
+            m_reproducible = True;
+        else if (arg == "--report")
+            m_generator.setReport(True);
+        else
+            m_args.push_back(arg);
+    }
+
+    if (trace)
+        O3D_ERROR(E_InvalidParameter("Missing trace file name after --trace"));
+
+    if (jobs)
+        O3D_ERROR(E_InvalidParameter("Missing number after --jobs"));
+
+    if (shard)
+        O3D_ERROR(E_InvalidParameter("Missing index/count after --shard"));
+
+    if (shards)
+        O3D_ERROR(E_InvalidParameter("Missing number after --shards"));
+
+    if (m_shardCount > 1 && m_shards > 1)
+        O3D_ERROR(E_InvalidParameter("--shard and --shards are exclusive"));
+
+    // the transitive includes need every data file
+    if (m_generator.isReport() && (m_shardCount > 1 || m_shards > 1))
+        O3D_ERROR(E_InvalidParameter("--report needs an unsharded generation"));
 }
 
 void Main::init()
 {
-    CommandLine *cmd = Application::getCommandLine();
+    if (m_args.empty())
+        O3D_ERROR(E_InvalidParameter("Invalid config file"));
+
+    StatsScope scope(m_generator.getStats(), "Main::init", "<config>", Stats::PHASE_LOAD);
 
-    String configFilename = cmd->getArgs().back() + "/datamodelgen";
-    if (configFilename.isEmpty())
+    m_configFile = m_args.back() + "/datamodelgen";
+    if (m_configFile.isEmpty())
         O3D_ERROR(E_InvalidParameter("Invalid config file"));
 
-    readConfig(configFilename);
+    readConfig(m_configFile, m_generator);
 
-    Date date(True);
-    m_year = date.buildString("%y");
-    m_month = date.buildString("%M");
-    m_day = date.buildString("%D");
+    // the command line has priority over the config
+    if (m_jobs > 0)
+        m_generator.setJobs(m_jobs);
 
-    LocalDir inPath(m_inPath);
+    m_generator.setShard(m_shardIndex, m_shardCount);
+
+    if (m_reproducible)
+        m_generator.setReproducible(True);
+
+    LocalDir inPath(m_generator.getInPath());
     if (!inPath.exists())
         O3D_ERROR(E_InvalidParameter("Invalid input path"));
 
     for (Int32 n = 0; n < 2; ++n)
     {
-        LocalDir displayerOutPath(m_outPath[n][DataFile::DISPLAYER]);
-        if (!displayerOutPath.exists())
-            O3D_ERROR(E_InvalidParameter("Invalid displayer output path"));
+        static const char* profileNames[3] = { "displayer", "authority", "editor" };
 
-        LocalDir authorityOutPath(m_outPath[n][DataFile::AUTHORITY]);
-        if (!authorityOutPath.exists())
-            O3D_ERROR(E_InvalidParameter("Invalid authority output path"));
+        for (Int32 p = 0; p < 3; ++p)
+        {
+            DataFile::Profile profile = (DataFile::Profile)p;
+            if (!m_generator.isBuild(profile))
+                continue;
 
-        LocalDir editorOutPath(m_outPath[n][DataFile::EDITOR]);
-        if (!editorOutPath.exists())
-            O3D_ERROR(E_InvalidParameter("Invalid editor output path"));
+            LocalDir outPath(n == 0 ? m_generator.getOutHppPath(profile) : m_generator.getOutCppPath(profile));
+            if (!outPath.exists())
+                O3D_ERROR(E_InvalidParameter(String("Invalid ") + profileNames[p] + " output path"));
+        }
     }
 
-    LocalDir tlpPath(m_tplPath);
+    LocalDir tlpPath(m_generator.getTemplatesPath());
     if (!tlpPath.exists())
          O3D_ERROR(E_InvalidParameter("Invalid template path"));
 
-    System::print(String::print("%i", m_version), "Generate version");
+    System::print(String::print("%i", m_generator.getVersion()), "Generate version");
 
-    readTemplate(m_tplPath + "/license.template", m_templates[TPL_LICENCE]);
-    readTemplate(m_tplPath + "/hpp.template", m_templates[TPL_HPP]);
-    readTemplate(m_tplPath + "/cpp.template", m_templates[TPL_CPP]);
-    readTemplate(m_tplPath + "/data.reader.class.template", m_templates[TPL_DATA_READER_CLASS]);
-    readTemplate(m_tplPath + "/data.writer.class.template", m_templates[TPL_DATA_WRITER_CLASS]);
-    readTemplate(m_tplPath + "/data.reader.user.impl.template", m_templates[TPL_DATA_READER_USER_IMPL]);
-    readTemplate(m_tplPath + "/data.reader.impl.template", m_templates[TPL_DATA_READER_IMPL]);
-    readTemplate(m_tplPath + "/data.writer.impl.template", m_templates[TPL_DATA_WRITER_IMPL]);
+    m_generator.readTemplates();
 }
 
 void Main::run()
 {
-    // Any found messages
-    FileListing files;
-    files.setPath(m_inPath);
-    files.setExt("*." + m_classExt + "|*." + m_typeDefExt);
-    files.searchFirstFile();
-
-    FLItem *fl;
-    while ((fl = files.searchNextFile()) != nullptr)
+    if (m_shards > 1)
+        runShards();
+    else
+        m_generator.run();
+}
+
+void Main::runShards()
+{
+    std::vector<std::unique_ptr<Generator>> shards;
+
+    // the threads are shared by the shards
+    UInt32 jobs = m_generator.getJobs() / m_shards;
+
+    for (UInt32 i = 0; i < m_shards; ++i)
     {
-        if (fl->FileType == FILE_FILE)
-        {
-            // process the data file
-            DataFile *data = new DataFile("", files.getFileFullName(), "Data", m_composite);
-            m_parsed.push_back(data);
-
-            if (fl->FileName.endsWith(".dmg"))
-                data->parseClassFile();
-            else if (fl->FileName.endsWith(".tdg"))
-                data->parseTypedefFile();
-        }
-        else if (fl->FileType == FILE_DIR)
-        {
-            // we want only a relative directory
-            if (!fl->FileName.startsWith("."))
-                browseSubFolder(fl->FileName);
-        }
+        std::unique_ptr<Generator> shard(new Generator(m_sources, m_output));
+
+        readConfig(m_configFile, *shard);
+
+        shard->setJobs(jobs);
+        shard->setShard(i, m_shards);
+        shard->setDate(m_generator.getYear(), m_generator.getMonth(), m_generator.getDay());
+        shard->setReproducible(m_generator.isReproducible());
+        shard->readTemplates();
+
+        shards.push_back(std::move(shard));
     }
 
-    // second step process
-    for (DataFile *data : m_parsed)
+    std::vector<std::exception_ptr> errors(m_shards);
+    std::vector<std::thread> threads;
+
+    for (UInt32 i = 0; i < m_shards; ++i)
+    {
+        threads.push_back(std::thread([&shards, &errors, i] () {
+            try {
+                shards[i]->run();
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }));
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (std::exception_ptr &error : errors)
     {
-        data->process();
-        deletePtr(data);
+        if (error)
+            std::rethrow_exception(error);
     }
+
+    mergeShards();
 }
 
-void Main::browseSubFolder(const String &path)
+Int32 Main::command()
 {
-    // Any found messages
-    FileListing files;
-    files.setPath(m_inPath + "/" + path);
-    files.setExt("*." + m_classExt + "|*." + m_typeDefExt);
-    files.searchFirstFile();
-
-    FLItem *fl;
-    while ((fl = files.searchNextFile()) != nullptr)
+    if (m_args.size() >= 2)
     {
-        if (fl->FileType == FILE_FILE)
-        {
-            // process the data file
-            DataFile *data = new DataFile(path, files.getFileFullName(), "Data", m_composite);
-            m_parsed.push_back(data);
-
-            if (fl->FileName.endsWith(".dmg"))
-                data->parseClassFile();
-            else if (fl->FileName.endsWith(".tdg"))
-                data->parseTypedefFile();
-        }
-        else if (fl->FileType == FILE_DIR)
+        String op = m_args[0];
+        String data = m_args[1];
+
+        // mv, rename a data file, its references and its outputs
+        if (op == "mv" && data.isValid() && m_args.size() >= 4)
+            return moveData(data, m_args[2]);
+
+        // rm, remove a data file and its outputs
+        if (op == "rm" && data.isValid() && m_args.size() >= 3)
+            return removeData(data);
+
+        // merge, combine the manifests of the shards
+        if (op == "merge" && m_args.size() == 2)
+            return mergeShards();
+
+        System::print("Invalid command", "DataModelGen", System::MSG_ERROR);
+        return -1;
+    }
+
+    return 1;
+}
+
+//! Remove a file if it exists.
+static void removeFile(const String &filename)
+{
+    String name, path;
+    FileManager::getFileNameAndPath(filename, name, path);
+    path.trimRight('/');
+
+    LocalDir dir(path);
+    if (dir.check(name) == LocalDir::SUCCESS)
+        dir.removeFile(name);
+}
+
+void Main::loadXRef()
+{
+    XRefIndex &xref = m_generator.getXRefIndex();
+    String filename = m_generator.getXRefFileName();
+
+    if (filename.isValid() && m_output.exists(filename))
+    {
+        T_StringList lines;
+        m_output.read(filename, lines);
+
+        if (xref.read(lines))
+            return;
+    }
+
+    // missing or unknown format, only this time the whole tree is scanned
+    System::print("Build the cross-reference index", "DataModelGen");
+    m_generator.scanSources();
+}
+
+void Main::listOutputs(const String &data, T_StringList &generated, T_StringList &user) const
+{
+    Int32 pos = data.reverseFind('/');
+    String name = data.sub(pos + 1, -1);
+
+    // the output sub-folder of a data file has dots in place of slashes
+    String folder = pos > 0 ? data.sub(0, pos) : String();
+    folder.replace('/', '.');
+
+    for (Int32 p = 0; p < 3; ++p)
+    {
+        DataFile::Profile profile = (DataFile::Profile)p;
+        if (m_generator.getOutHppPath(profile).isEmpty() || m_generator.getOutCppPath(profile).isEmpty())
+            continue;
+
+        String hppPath = m_generator.getOutHppPath(profile);
+        String cppPath = m_generator.getOutCppPath(profile);
+
+        if (folder.isValid())
         {
-            if (!fl->FileName.startsWith("."))
-                browseSubFolder(path + "/" + fl->FileName);
+            hppPath += "/" + folder;
+            cppPath += "/" + folder;
         }
+
+        generated.push_back(hppPath + "/" + name + "Data." + m_generator.getHppExt());
+        generated.push_back(cppPath + "/" + name + "Data." + m_generator.getCppExt());
+        generated.push_back(cppPath + "/" + name + "Data.inl");
+        generated.push_back(cppPath + "/" + name + "Data.bench." + m_generator.getCppExt());
+
+        user.push_back(cppPath + "/" + name + "Data.user." + m_generator.getCppExt());
+        user.push_back(cppPath + "/" + name + "Data.user.inl");
     }
 }
 
-Int32 Main::command()
+Int32 Main::moveData(const String &from, const String &to)
 {
-    CommandLine *cmd = Application::getCommandLine();
+    XRefIndex &xref = m_generator.getXRefIndex();
+    loadXRef();
 
-    if (cmd->getArgs().size() >= 2)
+    String fromSource = from + "." + m_generator.getClassExt();
+    String toSource = to + "." + m_generator.getClassExt();
+
+    if (!xref.getEntries(fromSource))
     {
-        String op = cmd->getArgs()[0];
-        String data = cmd->getArgs()[1];
+        System::print("Unknown data file " + fromSource, "DataModelGen", System::MSG_ERROR);
+        return -1;
+    }
 
-        // mv, rename a data from source and targets
-        if (op == "mv" && data.isValid() && cmd->getArgs().size() >= 3)
-        {
-            String dataTo = cmd->getArgs()[2];
+    if (xref.getEntries(toSource) || m_output.exists(m_generator.getInPath() + "/" + toSource))
+    {
+        System::print("Data file " + toSource + " exists", "DataModelGen", System::MSG_ERROR);
+        return -1;
+    }
 
-            LocalDir source(m_inPath);
-            if (source.check(data + ".dmg") == LocalDir::SUCCESS)
-            {
-                renameData(
-                            source.getFullPathName() + "/" + data + ".dmg",
-                            source.getFullPathName() + "/" + dataTo + ".dmg",
-                            data,
-                            dataTo);
-                source.removeFile(data + ".dmg");
-            }
+    // imports are dotted paths from the input
+    String fromImport = from;
+    fromImport.replace('/', '.');
+    String toImport = to;
+    toImport.replace('/', '.');
 
-            // file type
-            for (Int32 n = 0; n < 2; ++n)
-            {
-                // profiles
-                for (Int32 i = 0; i < 3; ++i)
-                {
-                    LocalDir out(m_outPath[n][i]);
-                    if (out.check(data + "Data." + m_hppExt) == LocalDir::SUCCESS)
-                    {
-                        renameDataHeader(
-                                    out.getFullPathName() + "/" + data + "Data." + m_hppExt,
-                                    out.getFullPathName() + "/" + dataTo + "Data." + m_hppExt,
-                                    data,
-                                    dataTo);
-                        out.removeFile(data + "Data." + m_hppExt);
-                    }
-                    if (out.check(data + "Data." + m_cppExt) == LocalDir::SUCCESS)
-                    {
-                        renameDataImpl(
-                                    out.getFullPathName() + "/" + data + "Data." + m_cppExt,
-                                    out.getFullPathName() + "/" + dataTo + "Data." + m_cppExt,
-                                    data,
-                                    dataTo);
-                        out.removeFile(data + "Data." + m_cppExt);
-                    }
-                }
-            }
+    // the data named as its file is renamed with the file
+    String fromData = from.sub(from.reverseFind('/') + 1, -1);
+    String toData = to.sub(to.reverseFind('/') + 1, -1);
 
-            return 0;
-        }
+    if (xref.findDeclaration(fromData) != fromSource)
+        fromData = toData = String();
 
-        // rm, remove a data from source and targets
-        if (op == "rm" && data.isValid())
-        {
-            LocalDir source(m_inPath);
-            if (source.check(data + ".dmg") == LocalDir::SUCCESS)
-                source.removeFile(data + ".dmg");
+    std::set<String> affected;
+    affected.insert(fromSource);
+    xref.findSources(fromImport, affected);
+    if (fromData.isValid())
+        xref.findSources(fromData, affected);
+
+    T_StringList names;
+
+    for (const String &source : affected)
+    {
+        T_StringList lines;
+        m_sources.read(m_generator.getInPath() + "/" + source, lines);
+
+        Bool changed = XRefIndex::rewrite(lines, fromImport, toImport, fromData, toData);
 
-            // file type
-            for (Int32 n = 0; n < 2; ++n)
+        String target = source == fromSource ? toSource : source;
+        if (changed || target != source)
+        {
+            TextBuffer buffer;
+            for (const String &line : lines)
             {
-                // profiles
-                for (Int32 i = 0; i < 3; ++i)
-                {
-                    LocalDir out(m_outPath[n][i]);
-                    if (out.check(data + "Data." + m_hppExt) == LocalDir::SUCCESS)
-                        out.removeFile(data + "Data." + m_hppExt);
-                    if (out.check(data + "Data." + m_cppExt) == LocalDir::SUCCESS)
-                        out.removeFile(data + "Data." + m_cppExt);
-                    if (out.check(data + "Data.user." + m_cppExt) == LocalDir::SUCCESS)
-                        out.removeFile(data + "Data.user." + m_cppExt);
-                }
+                buffer.writeLine(line);
             }
 
-            return 0;
+            m_output.write(m_generator.getInPath() + "/" + target, std::move(buffer));
+            System::print(target, source == fromSource ? "Move data file" : "Update data file");
         }
 
-        System::print("Invalid command", "DataModelGen", System::MSG_ERROR);
-        return -1;
+        xref.scan(target, lines);
+        names.push_back(target);
     }
 
-    return 1;
-}
+    removeFile(m_generator.getInPath() + "/" + fromSource);
+    xref.remove(fromSource);
 
-void Main::renameData(const String &filenameFrom, const String &filenameTo, const String &from, const String &to)
-{
-    AutoPtr<InStream> fileFrom(FileManager::instance()->openInStream(filenameFrom));
-    AutoPtr<FileOutStream> fileTo(FileManager::instance()->openOutStream(filenameTo, FileOutStream::CREATE));
+    // previous outputs, the user implementations are moved with their class renamed
+    T_StringList fromGenerated, fromUser, toGenerated, toUser;
+    listOutputs(from, fromGenerated, fromUser);
+    listOutputs(to, toGenerated, toUser);
 
-    String line, l;
+    for (const String &filename : fromGenerated)
+    {
+        removeFile(filename);
+    }
 
-    while (fileFrom->readLine(line) != -1)
+    auto toIt = toUser.begin();
+    for (const String &filename : fromUser)
     {
-        l = line;
-        l.trimLeftChars(" \t");
-        if (l.startsWith("data"))
+        const String &target = *toIt++;
+        if (!m_output.exists(filename))
+            continue;
+
+        T_StringList lines;
+        m_output.read(filename, lines);
+
+        TextBuffer buffer;
+        for (String &line : lines)
         {
-            // TODO more sensitive test
-            line.replace(from, to);
+            XRefIndex::renameToken(line, fromData.isValid() ? fromData + "Data" : String(), toData + "Data", False);
+            buffer.writeLine(line);
         }
 
-        fileTo->writeLine(line);
+        m_output.write(target, std::move(buffer));
+        removeFile(filename);
     }
+
+    m_generator.writeXRef();
+
+    if (m_generator.isUnity() || m_generator.isExplicitTemplates() || m_generator.isBenchmark())
+        System::print("Unity, templates and benchmark files are updated by the next generation",
+                      "DataModelGen", System::MSG_WARNING);
+
+    // regenerate only the affected files
+    m_generator.run(names);
+
+    return 0;
 }
 
-void Main::renameDataHeader(
-        const String &filenameFrom,
-        const String &filenameTo,
-        const String &from,
-        const String &to)
+Int32 Main::removeData(const String &data)
 {
-    AutoPtr<InStream> fileFrom(FileManager::instance()->openInStream(filenameFrom));
-    AutoPtr<FileOutStream> fileTo(FileManager::instance()->openOutStream(filenameTo, FileOutStream::CREATE));
+    XRefIndex &xref = m_generator.getXRefIndex();
+    loadXRef();
+
+    String source = data + "." + m_generator.getClassExt();
 
-    String line;
+    if (!xref.getEntries(source))
+    {
+        System::print("Unknown data file " + source, "DataModelGen", System::MSG_ERROR);
+        return -1;
+    }
 
-    String FROM(from);
-    FROM.upper();
-    String TO(to);
-    TO.upper();
+    // the references from other files can only be fixed by hand
+    String import = data;
+    import.replace('/', '.');
 
-    while (fileFrom->readLine(line) != -1)
+    std::set<String> symbols;
+    symbols.insert(import);
+
+    for (const XRefIndex::Entry &entry : *xref.getEntries(source))
     {
-        // TODO more sensitive test
-        line.replace(from, to);
-        line.replace(FROM, TO);
-        fileTo->writeLine(line);
+        if (entry.kind == XRefIndex::DECLARE)
+            symbols.insert(entry.symbol);
     }
-}
 
-void Main::renameDataImpl(
-        const String &filenameFrom,
-        const String &filenameTo,
-        const String &from,
-        const String &to)
-{
-    AutoPtr<InStream> fileFrom(FileManager::instance()->openInStream(filenameFrom));
-    AutoPtr<FileOutStream> fileTo(FileManager::instance()->openOutStream(filenameTo, FileOutStream::CREATE));
+    for (const String &symbol : symbols)
+    {
+        std::set<String> sources;
+        xref.findSources(symbol, sources);
 
-    String line;
+        for (const String &other : sources)
+        {
+            if (other == source)
+                continue;
 
-    String FROM(from);
-    FROM.upper();
-    String TO(to);
-    TO.upper();
+            for (const XRefIndex::Entry &entry : *xref.getEntries(other))
+            {
+                if (entry.symbol == symbol)
+                    System::print(String::print("line %u ", entry.line) + XRefIndex::getKindName(entry.kind) +
+                                  " " + symbol, "Dangling reference into " + other, System::MSG_WARNING);
+            }
+        }
+    }
+
+    removeFile(m_generator.getInPath() + "/" + source);
+
+    T_StringList generated, user;
+    listOutputs(data, generated, user);
 
-    while (fileFrom->readLine(line) != -1)
+    for (const String &filename : generated)
     {
-        // TODO more sensitive test
-        line.replace(from, to);
-        line.replace(FROM, TO);
-        fileTo->writeLine(line);
+        removeFile(filename);
     }
-}
 
-UInt32 Main::getNextDataId()
-{
-    return m_messageId.getID();
+    for (const String &filename : user)
+    {
+        removeFile(filename);
+    }
+
+    xref.remove(source);
+    m_generator.writeXRef();
+
+    return 0;
 }
 
-void Main::registerDataId(UInt32 dataId)
+Int32 Main::mergeShards()
 {
-    m_messageId.forceID(dataId);
+    UInt32 count = m_generator.mergeShards();
+    System::print(String::print("%u shards", count), "Merged");
+
+    // combined once
+    for (UInt32 i = 0; i < count; ++i)
+    {
+        removeFile(m_generator.getShardFileName(i));
+    }
+
+    return 0;
 }
 
+#ifndef DMG_HEADLESS
 Int32 Main::main()
 {
     Debug::instance()->setDefaultLog("datamodelgen.log");
     Debug::instance()->getDefaultLog().clearLog();
 
-    CommandLine *cmd = Application::getCommandLine();
-    if (cmd->getArgs().size() == 0)
+    T_StringList args;
+    for (const String &arg : Application::getCommandLine()->getArgs())
+    {
+        args.push_back(arg);
+    }
+
+    return exec(args);
+}
+#endif
+
+Int32 Main::exec(const T_StringList &args)
+{
+    Main *apps = new Main();
+    apps->parseArgs(args);
+
+    if (apps->m_args.size() == 0)
     {
         System::print("Missing path to datamodelgen file", "", System::MSG_ERROR);
+        deletePtr(apps);
         return -1;
     }
 
-    Main *apps = new Main();
     apps->init();
 
     Int32 res = apps->command();
@@ -358,122 +552,70 @@ Int32 Main::main()
     } catch (E_BaseException &e) {
     }
 
+    apps->m_generator.printFanOut();
+    apps->m_generator.printReport();
+    apps->m_generator.getStats().print();
+    apps->m_generator.getStats().writeTrace(apps->m_output);
+
     // Destroy any content
     deletePtr(apps);
 
     return 0;
 }
 
-void Main::readTemplate(const String &filename, T_StringList &lines)
+void Main::readConfig(const String &filename, Generator &generator)
 {
-    // read templates
-    InStream *is = FileManager::instance()->openInStream(filename);
+    T_StringList lines;
+    m_sources.read(filename, lines);
 
-    String line;
-    while (is->readLine(line) != EOF)
-    {
-        lines.push_back(line);
-    }
+    TextReader reader(lines);
+    generator.getStats().addBytesRead("<config>", reader.getSize());
 
-    deletePtr(is);
-}
+    generator.readConfig(lines);
 
-void Main::readConfig(const String &filename)
-{
-    // read templates
-    InStream *is = FileManager::instance()->openInStream(filename);
+    // relative paths are from the working directory
+    FileManager *fm = FileManager::instance();
+
+    if (generator.getInPath().isValid())
+        generator.setInPath(fm->getFullFileName(generator.getInPath()));
 
-    String line;
-    Int32 equalPos;
-    String key, value;
+    if (generator.getTemplatesPath().isValid())
+        generator.setTemplatesPath(fm->getFullFileName(generator.getTemplatesPath()));
 
-    while (is->readLine(line) != -1)
+    for (Int32 p = 0; p < 3; ++p)
     {
-        line.trimLeftChars(" \t");
-        line.trimRightChars(" \t");
+        DataFile::Profile profile = (DataFile::Profile)p;
 
-        // comment or empty line
-        if (line.startsWith("#") || line.isEmpty())
-            continue;
+        if (generator.getOutHppPath(profile).isValid())
+            generator.setOutPath(DataFile::F_HPP, profile, fm->getFullFileName(generator.getOutHppPath(profile)));
 
-        // find the first = and split at
-        equalPos = line.find('=');
-        if (equalPos > 0)
-        {
-            key = line.sub(0, equalPos);
-            key.trimRight(' ');
-
-            value = line.sub(equalPos+1, -1);
-            value.trimLeft(' ');
-
-            if (key == "author")
-                m_author = value;
-            else if (key == "displayer.namespace")
-                m_namespace[DataFile::DISPLAYER] = value;
-            else if (key == "authority.namespace")
-                m_namespace[DataFile::AUTHORITY] = value;
-            else if (key == "editor.namespace")
-                m_namespace[DataFile::EDITOR] = value;
-            else if (key == "input")
-                m_inPath = FileManager::instance()->getFullFileName(value);
-
-            // unified outputs folders
-            else if (key == "displayer.output")
-                m_outPath[0][DataFile::DISPLAYER] =
-                        m_outPath[1][DataFile::DISPLAYER] = FileManager::instance()->getFullFileName(value);
-            else if (key == "authority.output")
-                m_outPath[0][DataFile::AUTHORITY] =
-                        m_outPath[1][DataFile::AUTHORITY] = FileManager::instance()->getFullFileName(value);
-            else if (key == "editor.output")
-                m_outPath[0][DataFile::EDITOR] =
-                        m_outPath[1][DataFile::EDITOR] = FileManager::instance()->getFullFileName(value);
-            // distincts headers folders
-            else if (key == "displayer.output.headers")
-                m_outPath[0][DataFile::DISPLAYER] = FileManager::instance()->getFullFileName(value);
-            else if (key == "authority.output.headers")
-                m_outPath[0][DataFile::AUTHORITY] = FileManager::instance()->getFullFileName(value);
-            else if (key == "editor.output.headers")
-                m_outPath[0][DataFile::EDITOR] = FileManager::instance()->getFullFileName(value);
-            // distincts sources folders
-            else if (key == "displayer.output.sources")
-                m_outPath[1][DataFile::DISPLAYER] = FileManager::instance()->getFullFileName(value);
-            else if (key == "authority.output.sources")
-                m_outPath[1][DataFile::AUTHORITY] = FileManager::instance()->getFullFileName(value);
-            else if (key == "editor.output.sources")
-                m_outPath[1][DataFile::EDITOR] = FileManager::instance()->getFullFileName(value);
-            // include folders
-            else if (key == "displayer.output.includes")
-                m_outPath[2][DataFile::DISPLAYER] =value;
-            else if (key == "authority.output.includes")
-                m_outPath[2][DataFile::AUTHORITY] = value;
-            else if (key == "editor.output.includes")
-                m_outPath[2][DataFile::EDITOR] = value;
-
-            else if (key == "export")
-            {
-                m_build[DataFile::DISPLAYER] = m_build[DataFile::AUTHORITY] = m_build[DataFile::EDITOR] = False;
-
-                if (value.sub("displayer", 0) != -1)
-                    m_build[DataFile::DISPLAYER] = True;
-                else if (value.sub("authority", 0) != -1)
-                    m_build[DataFile::AUTHORITY] = True;
-                else if (value.sub("editor", 0) != -1)
-                    m_build[DataFile::EDITOR] = True;
-                if (value.sub("displayer", 0) != -1)
-                    m_build[DataFile::DISPLAYER] = m_build[DataFile::AUTHORITY] = m_build[DataFile::EDITOR] = True;
-            }
-            else if (key == "templates")
-                m_tplPath = FileManager::instance()->getFullFileName(value);
-            else if (key == "version")
-                m_version = value.toUInt32();
-            else if (key == "hppext")
-                m_hppExt = value;
-            else if (key == "cppext")
-                m_cppExt = value;
-        }
+        if (generator.getOutCppPath(profile).isValid())
+            generator.setOutPath(DataFile::F_CPP, profile, fm->getFullFileName(generator.getOutCppPath(profile)));
     }
 
-    deletePtr(is);
+    String xrefFile = generator.getXRefFileName();
+    if (xrefFile.isValid())
+        generator.setXRefFileName(fm->getFullFileName(xrefFile));
 }
 
+#ifdef DMG_HEADLESS
+int main(int argc, char **argv)
+{
+    // neither o3d application, nor display, nor memory managers, only the core classes
+    T_StringList args;
+    for (int i = 1; i < argc; ++i)
+    {
+        args.push_back(String(argv[i]));
+    }
+
+    try {
+        return Main::exec(args);
+    } catch (E_BaseException &e)
+    {
+        System::print(e.getMsg(), e.getDescr(), System::MSG_ERROR);
+        return -1;
+    }
+}
+#else
 O3D_CONSOLE_MAIN(Main, O3D_DEFAULT_CLASS_SETTINGS)
+#endif
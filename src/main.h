@@ -17,9 +17,8 @@
 #include <o3d/core/stringlist.h>
 #include <o3d/core/stringmap.h>
 
-#include <o3d/core/idmanager.h>
-
-#include "datafile.h"
+#include "generator.h"
+#include "fileprovider.h"
 
 namespace o3d {
 namespace dmg {
@@ -33,123 +32,84 @@ class Main : public BaseObject
 {
 public:
 
-    //! Get singleton.
-    static Main* instance();
-
     //! Default constructor.
     Main();
 
     //! Destructor.
     virtual ~Main();
 
+    //! Split the command line into options (--stats, --trace <file>) and arguments.
+    void parseArgs(const T_StringList &args);
+
     void init();
 
     void run();
 
+    //! Run the mv or rm command if given. Return 1 if there is no command.
     Int32 command();
 
-    void renameData(
-            const String &filenameFrom,
-            const String &filenameTo,
-            const String &from,
-            const String &to);
-
-    void renameDataHeader(
-            const String &filenameFrom,
-            const String &filenameTo,
-            const String &from,
-            const String &to);
-
-    void renameDataImpl(const String &filenameFrom,
-            const String &filenameTo,
-            const String &from,
-            const String &to);
-
-    //-----------------------------------------------------------------------------------
-    // Accessors
-    //-----------------------------------------------------------------------------------
-
-    enum TemplateType
-    {
-        TPL_LICENCE = 0,
-        TPL_HPP,
-        TPL_CPP,
-        TPL_DATA_READER_CLASS,
-        TPL_DATA_WRITER_CLASS,
-        TPL_DATA_READER_USER_IMPL,
-        TPL_DATA_READER_IMPL,
-        TPL_DATA_WRITER_IMPL,
-        TPL_LAST = TPL_DATA_WRITER_IMPL
-    };
-
-    static const UInt32 NUM_TEMPLATE_TYPE = TPL_LAST + 1;
+    /**
+     * @brief Rename a data file (paths relative to the input, without extension), its
+     * data of the same name, and their references into the files found by the
+     * cross-reference index. Only the affected files are regenerated.
+     */
+    Int32 moveData(const String &from, const String &to);
 
-    const String& getInPath() const { return m_inPath; }
+    //! Remove a data file and its outputs, and report the references left.
+    Int32 removeData(const String &data);
 
-    const String& getOutHppPath(DataFile::Profile p) const { return m_outPath[0][p]; }
-    const String& getOutCppPath(DataFile::Profile p) const { return m_outPath[1][p]; }
-    const String& getIncludePath(DataFile::Profile p) const { return m_outPath[2][p]; }
+    //! Combine the manifests of the shards, then remove them.
+    Int32 mergeShards();
 
-    const String& getTypeDefExt() const { return m_typeDefExt; }
-    const String& getClassExt() const { return m_classExt; }
-    const String& getHppExt() const { return m_hppExt; }
-    const String& getCppExt() const { return m_cppExt; }
-
-    const T_StringList& getTemplate(TemplateType type) const { return m_templates[type]; }
-
-    UInt32 getVersion() const { return m_version; }
-
-    UInt32 getNextDataId();
-    void registerDataId(UInt32 dataId);
-
-    Bool isBuild(DataFile::Profile p) const { return m_build[p]; }
-
-    const String& getNamespace(DataFile::Profile p) const { return m_namespace[p]; }
-    const String& getAuthor() const { return m_author; }
-
-    const String& getYear() const { return m_year; }
-    const String& getMonth() const { return m_month; }
-    const String& getDay() const { return m_day; }
+    /**
+     * @brief Local coordinator of --shards : run each shard by its own generator on its
+     * own thread, as separated processes would, then merge them.
+     */
+    void runShards();
 
 private:
 
-    static Main *ms_instance;
+    //! Command line arguments without the options.
+    std::vector<String> m_args;
 
-    Bool m_composite;
+    //! Number of render threads given by --jobs (0 if not given, the config or the default is used).
+    UInt32 m_jobs;
 
-    String m_inPath;
-    String m_tplPath;
-    String m_outPath[3][3];
+    //! Shard of this process given by --shard i/N.
+    UInt32 m_shardIndex;
+    UInt32 m_shardCount;
 
-    String m_typeDefExt;
-    String m_classExt;
-    String m_hppExt;
-    String m_cppExt;
+    //! Number of shards run and merged by this process, given by --shards.
+    UInt32 m_shards;
 
-    UInt32 m_version;
+    //! Reproducible outputs given by --reproducible (else from the config).
+    Bool m_reproducible;
 
-    Bool m_build[3];
+    String m_configFile;
 
-    IDManager m_messageId;
+    FileSourceProvider m_sources;
+    FileOutputSink m_output;
 
-    T_StringList m_templates[NUM_TEMPLATE_TYPE];
-    std::list<DataFile*> m_parsed;
+    Generator m_generator;
 
-    String m_namespace[3];
-    String m_author;
+    //! Read the config file into a generator, and make its paths absolute.
+    void readConfig(const String &filename, Generator &generator);
 
-    String m_year;
-    String m_month;
-    String m_day;
+    //! Read the persisted cross-reference index, or build it if missing.
+    void loadXRef();
 
-    void readTemplate(const String &filename, T_StringList &lines);
-    void readConfig(const String &filename);
-
-    void browseSubFolder(const String &path);
+    //! Generated and user implementation files of a data file, for any profile.
+    void listOutputs(const String &data, T_StringList &generated, T_StringList &user) const;
 
 public:
 
+    //! Run the command line tool, args without the program name.
+    static Int32 exec(const T_StringList &args);
+
+#ifndef DMG_HEADLESS
+    //! Entry point from the o3d application.
     static Int32 main();
+#endif
 };
 
 } // namespace dmg
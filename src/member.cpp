@@ -13,12 +13,33 @@
 using namespace o3d;
 using namespace o3d::dmg;
 
-Member::Member(Member *parent) :
+Member::Member(Member *parent, Int32 builtin) :
     m_parent(parent),
+    m_builtin(builtin),
     m_public(False)
 {
 }
 
+const String& Member::getTypeName() const
+{
+    return getTypeStrings(m_builtin).keyword;
+}
+
+const String& Member::getOutTypeName() const
+{
+    return getTypeStrings(m_builtin).outType;
+}
+
+const String& Member::getReadMethod() const
+{
+    return getTypeStrings(m_builtin).readMethod;
+}
+
+const String& Member::getWriteMethod() const
+{
+    return getTypeStrings(m_builtin).writeMethod;
+}
+
 Member::~Member()
 {
 
@@ -26,7 +47,13 @@ Member::~Member()
 
 T_StringList Member::getHeaders() const
 {
-    return T_StringList();
+    T_StringList list;
+
+    // std::memcpy of the float columns (readBatch, writeBatch)
+    if (m_builtin == BT_FLOAT || m_builtin == BT_DOUBLE)
+        list.push_back("<cstring>");
+
+    return list;
 }
 
 String Member::getIfTest(const Member *param) const
@@ -55,11 +82,21 @@ Member *Member::findMember(const String &name) const
         return nullptr;
 }
 
+const std::list<Member*>* Member::getChildren() const
+{
+    return nullptr;
+}
+
 void Member::setCond(Member *var, Member *varParam)
 {
     // nothing
 }
 
+void Member::link()
+{
+    // nothing
+}
+
 void Member::setPublic()
 {
     m_public = True;
@@ -90,7 +127,7 @@ const String &Member::getValue() const
     return m_value;
 }
 
-void Member::writeDecl(OutStream *os)
+void Member::writeDecl(TextBuffer *os) const
 {
     Int32 ident = 1;
     Member *parent = m_parent;
@@ -110,7 +147,7 @@ void Member::writeDecl(OutStream *os)
     os->writeLine(line);
 }
 
-void Member::writeRead(OutStream *os)
+void Member::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
     Member *parent = m_parent;
@@ -126,12 +163,17 @@ void Member::writeRead(OutStream *os)
         line += "    ";
     }
 
-    line += String((m_parent ? m_parent->getPrefix() : String("")) + m_name + " = is.") + getReadMethod() + "();";
+    String prefixedName = (m_parent ? m_parent->getPrefix() : String("")) + m_name;
+
+    if (isEncoded())
+        line += prefixedName + " = " + getReadMethod() + "(is);";
+    else
+        line += prefixedName + " = is." + getReadMethod() + "();";
 
     os->writeLine(line);
 }
 
-void Member::writeWrite(OutStream *os)
+void Member::writeWrite(TextBuffer *os) const
 {
     Int32 ident = 1;
     Member *parent = m_parent;
@@ -147,17 +189,22 @@ void Member::writeWrite(OutStream *os)
         line += "    ";
     }
 
-    line += String("os.") + getWriteMethod() + "(" + (m_parent ? m_parent->getPrefix() : "") + m_name + ");";
+    String prefixedName = (m_parent ? m_parent->getPrefix() : String("")) + m_name;
+
+    if (isEncoded())
+        line += getWriteMethod() + "(os, " + prefixedName + ");";
+    else
+        line += String("os.") + getWriteMethod() + "(" + prefixedName + ");";
 
     os->writeLine(line);
 }
 
-void Member::writeFinalize(Context &ctx)
+void Member::writeFinalize(Context &ctx) const
 {
     // nothing
 }
 
-void Member::writeSetterDecl(OutStream *os)
+void Member::writeSetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -180,14 +227,23 @@ void Member::writeSetterDecl(OutStream *os)
     os->writeLine(line);
     os->writeLine("    }");
     os->writeLine("");
+
+    if (isMovable())
+    {
+        os->writeLine("    void set" + name + "(" + getOutTypeName() + " &&" + mname + ")");
+        os->writeLine("    {");
+        os->writeLine("        " + getName() + " = std::move(" + mname + ");");
+        os->writeLine("    }");
+        os->writeLine("");
+    }
 }
 
-void Member::writeSetterImpl(OutStream *os)
+void Member::writeSetterImpl(TextBuffer *os) const
 {
 
 }
 
-void Member::writeGetterDecl(OutStream *os)
+void Member::writeGetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -211,7 +267,7 @@ void Member::writeGetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void Member::writeGetterImpl(OutStream *os)
+void Member::writeGetterImpl(TextBuffer *os) const
 {
 
 }
@@ -228,12 +284,240 @@ String Member::getPrefix() const
 
 UInt32 Member::getMinSize() const
 {
-    return 0;
+    return m_builtin >= 0 ? getTypeDescriptor((BuiltinType)m_builtin).minSize : 0;
+}
+
+Bool Member::isFixedSize() const
+{
+    return m_builtin >= 0 ? getTypeDescriptor((BuiltinType)m_builtin).fixed : False;
 }
 
 Bool Member::isRef() const
 {
-    return False;
+    return m_builtin >= 0 ? getTypeDescriptor((BuiltinType)m_builtin).ref : False;
+}
+
+Bool Member::isMovable() const
+{
+    return m_builtin == BT_UTF8STRING;
+}
+
+Bool Member::isTriviallyDestructible() const
+{
+    return m_builtin != BT_STRING && m_builtin != BT_UTF8STRING && m_builtin != BT_ARRAY8;
+}
+
+Bool Member::isEncoded() const
+{
+    return m_builtin >= 0 ? getTypeDescriptor((BuiltinType)m_builtin).encoded : False;
+}
+
+Member::Column Member::getColumn() const
+{
+    switch (m_builtin)
+    {
+        case BT_BOOL:
+        case BT_INT8:
+        case BT_UINT8:
+        case BT_INT16:
+        case BT_UINT16:
+        case BT_INT32:
+        case BT_UINT32:
+        case BT_INT64:
+        case BT_UINT64:
+        case BT_FLOAT:
+        case BT_DOUBLE:
+            return COLUMN_RAW;
+        case BT_VARINT32:
+        case BT_VARUINT32:
+        case BT_VARINT64:
+        case BT_VARUINT64:
+        case BT_FIXED_STRING:
+        case BT_STRINGVIEW:
+        case BT_UTF8STRING:
+            return COLUMN_STREAM;
+        case BT_BIT:
+        case BT_CONST_INT8:
+        case BT_CONST_INT16:
+        case BT_CONST_UINT32:
+        case BT_CTOR:
+        case BT_IMMEDIATE:
+            return COLUMN_NONE;
+        default:
+            return COLUMN_ROWS;
+    }
+}
+
+//! Unsigned integer type of size bytes, holding the bits of a column value.
+static String getColumnBitsType(UInt32 size)
+{
+    switch (size)
+    {
+        case 1:
+            return "o3d::UInt8";
+        case 2:
+            return "o3d::UInt16";
+        case 4:
+            return "o3d::UInt32";
+        default:
+            return "o3d::UInt64";
+    }
+}
+
+void Member::writeColumnRead(TextBuffer *os) const
+{
+    os->writeLine("    // " + m_name);
+
+    if (getColumn() == COLUMN_STREAM)
+    {
+        os->writeLine("    for (o3d::UInt32 i = 0; i < count; ++i)");
+        os->writeLine("    {");
+        os->writeLine("        records[i]." + m_name + " = " + getReadMethod() + "(is);");
+        os->writeLine("    }");
+        os->writeLine("");
+        return;
+    }
+
+    // little endian whatever the host, the bool as bytes as by readBool
+    UInt32 size = getTypeDescriptor((BuiltinType)m_builtin).minSize;
+    String bits = getColumnBitsType(size);
+    String sizeStr = String::print("%u", size);
+
+    os->writeLine("    for (o3d::UInt32 first = 0; first < count; first += 256)");
+    os->writeLine("    {");
+    os->writeLine("        o3d::UInt32 n = count - first < 256 ? count - first : 256;");
+    os->writeLine("        o3d::UInt8 column[256 * " + sizeStr + "];");
+    os->writeLine("");
+    os->writeLine("        is.read(column, n * " + sizeStr + ");");
+    os->writeLine("");
+    os->writeLine("        for (o3d::UInt32 i = 0; i < n; ++i)");
+    os->writeLine("        {");
+    os->writeLine("            " + bits + " v = 0;");
+    os->writeLine("            for (o3d::UInt32 b = 0; b < " + sizeStr + "; ++b)");
+    os->writeLine("            {");
+    os->writeLine("                v = (" + bits + ")(v | (" + bits + ")column[i * " + sizeStr + " + b] << (8 * b));");
+    os->writeLine("            }");
+    os->writeLine("");
+
+    if (m_builtin == BT_BOOL)
+        os->writeLine("            records[first + i]." + m_name + " = v != 0;");
+    else if (m_builtin == BT_FLOAT || m_builtin == BT_DOUBLE)
+        os->writeLine("            std::memcpy(&records[first + i]." + m_name + ", &v, " + sizeStr + ");");
+    else
+        os->writeLine("            records[first + i]." + m_name + " = (" + getOutTypeName() + ")v;");
+
+    os->writeLine("        }");
+    os->writeLine("    }");
+    os->writeLine("");
+}
+
+void Member::writeColumnWrite(TextBuffer *os) const
+{
+    os->writeLine("    // " + m_name);
+
+    if (getColumn() == COLUMN_STREAM)
+    {
+        os->writeLine("    for (o3d::UInt32 i = 0; i < count; ++i)");
+        os->writeLine("    {");
+        os->writeLine("        " + getWriteMethod() + "(os, records[i]." + m_name + ");");
+        os->writeLine("    }");
+        os->writeLine("");
+        return;
+    }
+
+    UInt32 size = getTypeDescriptor((BuiltinType)m_builtin).minSize;
+    String bits = getColumnBitsType(size);
+    String sizeStr = String::print("%u", size);
+
+    os->writeLine("    for (o3d::UInt32 first = 0; first < count; first += 256)");
+    os->writeLine("    {");
+    os->writeLine("        o3d::UInt32 n = count - first < 256 ? count - first : 256;");
+    os->writeLine("        o3d::UInt8 column[256 * " + sizeStr + "];");
+    os->writeLine("");
+    os->writeLine("        for (o3d::UInt32 i = 0; i < n; ++i)");
+    os->writeLine("        {");
+
+    if (m_builtin == BT_BOOL)
+    {
+        os->writeLine("            " + bits + " v = records[first + i]." + m_name + " ? 1 : 0;");
+    }
+    else if (m_builtin == BT_FLOAT || m_builtin == BT_DOUBLE)
+    {
+        os->writeLine("            " + bits + " v;");
+        os->writeLine("            std::memcpy(&v, &records[first + i]." + m_name + ", " + sizeStr + ");");
+    }
+    else
+    {
+        os->writeLine("            " + bits + " v = (" + bits + ")records[first + i]." + m_name + ";");
+    }
+
+    os->writeLine("            for (o3d::UInt32 b = 0; b < " + sizeStr + "; ++b)");
+    os->writeLine("            {");
+    os->writeLine("                column[i * " + sizeStr + " + b] = (o3d::UInt8)(v >> (8 * b));");
+    os->writeLine("            }");
+    os->writeLine("        }");
+    os->writeLine("");
+    os->writeLine("        os.write(column, n * " + sizeStr + ");");
+    os->writeLine("    }");
+    os->writeLine("");
+}
+
+void Member::writeReset(TextBuffer *os) const
+{
+    String name = getPrefixedName();
+
+    switch (m_builtin)
+    {
+        case BT_BOOL:
+            os->writeLine("    " + name + " = False;");
+            break;
+        case BT_INT8:
+        case BT_UINT8:
+        case BT_INT16:
+        case BT_UINT16:
+        case BT_INT32:
+        case BT_UINT32:
+        case BT_INT64:
+        case BT_UINT64:
+        case BT_FLOAT:
+        case BT_DOUBLE:
+        case BT_VARINT32:
+        case BT_VARUINT32:
+        case BT_VARINT64:
+        case BT_VARUINT64:
+            os->writeLine("    " + name + " = 0;");
+            break;
+        case BT_BITSET8:
+        case BT_BITSET16:
+        case BT_BITSET32:
+        case BT_BITSET64:
+        case BT_STRINGVIEW:
+            // inline, nothing allocated
+            os->writeLine("    " + name + " = " + getOutTypeName() + "();");
+            break;
+        case BT_ARRAY8:
+            // kept, a read of the same size reuses it
+            break;
+        case BT_STRING:
+            // truncated, keeping its buffer
+            os->writeLine("    " + name + ".truncate(0);");
+            break;
+        case BT_UTF8STRING:
+        case BT_FIXED_STRING:
+            os->writeLine("    " + name + ".clear();");
+            break;
+        case BT_UINT8_ARRAY:
+        case BT_UINT32_ARRAY:
+            // n, since into a loop i is the index of the element
+            os->writeLine("    for (o3d::UInt32 n = 0; n < " + m_value + "; ++n)");
+            os->writeLine("    {");
+            os->writeLine("        " + name + "[n] = 0;");
+            os->writeLine("    }");
+            break;
+        default:
+            // nothing stored (constants, bits, ctor...)
+            break;
+    }
 }
 
 String Member::getSetTo(const Member *param, SetValue value) const
@@ -256,7 +540,34 @@ String Member::getSetTo(const Member *param, SetValue value) const
 
 String Member::getSizeOf() const
 {
-    return "0";
+    return getTypeStrings(m_builtin).sizeOf;
+}
+
+String Member::getAccessorName() const
+{
+    String name = getName();
+    if (name.startsWith("_"))
+        name.remove(0, 1);
+    if (name.startsWith("m_"))
+        name.remove(0, 2);
+    if (name.length() >= 1)
+        name[0] = WideChar::toUpper(name[0]);
+
+    return name;
+}
+
+String Member::getBenchValue() const
+{
+    return getTypeStrings(m_builtin).benchValue;
+}
+
+void Member::writeBenchFill(TextBuffer *os, const String &obj) const
+{
+    String value = getBenchValue();
+    if (value.isEmpty() || isParent())
+        return;
+
+    os->writeLine("    " + obj + ".set" + getAccessorName() + "(" + value + ");");
 }
 
 void Member::setTemplatesArgs(const T_StringList &args)
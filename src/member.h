@@ -14,7 +14,9 @@
 #include <o3d/core/stringlist.h>
 #include <o3d/core/stringmap.h>
 #include "context.h"
+#include "typedescriptor.h"
 
+#include <list>
 #include <vector>
 
 namespace o3d {
@@ -71,7 +73,14 @@ public:
         TYPE_CTOR,
         TYPE_CUSTOM,
         TYPE_CUSTOM_REF,
-        TYPE_CUSTOM_ARRAY
+        TYPE_CUSTOM_ARRAY,
+        TYPE_VARINT32,
+        TYPE_VARUINT32,
+        TYPE_VARINT64,
+        TYPE_VARUINT64,
+        TYPE_STRINGVIEW,
+        TYPE_UTF8STRING,
+        TYPE_FIXED_STRING
     };
 
     enum SetValue
@@ -80,7 +89,13 @@ public:
         SET_TRUE
     };
 
-    Member(Member *parent);
+    /**
+     * @brief Member
+     * @param parent
+     * @param builtin Builtin type (@see BuiltinType) giving the names and sizes of
+     *        the member, or -1 if the getters are overridden (custom types).
+     */
+    Member(Member *parent, Int32 builtin = -1);
 
     virtual ~Member();
 
@@ -94,25 +109,25 @@ public:
      * @brief getTypeName Type name of the member in local language.
      * @return
      */
-    virtual String getTypeName() const = 0;
+    virtual const String& getTypeName() const;
 
     /**
      * @brief getOutTypeName Type name for the output language.
      * @return
      */
-    virtual String getOutTypeName() const = 0;
+    virtual const String& getOutTypeName() const;
 
     /**
      * @brief getReadMethod Name of the method for reading the member.
      * @return
      */
-    virtual String getReadMethod() const = 0;
+    virtual const String& getReadMethod() const;
 
     /**
      * @brief getWriteMethod Name of the method for writting the member.
      * @return
      */
-    virtual String getWriteMethod() const = 0;
+    virtual const String& getWriteMethod() const;
 
     //! Get the related includes files (default is an empty list).
     virtual T_StringList getHeaders() const;
@@ -176,6 +191,9 @@ public:
     //! Find a direct child member, or if not found up to the parent recursively.
     virtual Member* findMember(const String &name) const;
 
+    //! Children members (loop, if...), or nullptr (default).
+    virtual const std::list<Member*>* getChildren() const;
+
     /**
      * @brief setCond Set the condition variable and the condition parameter (loop, if...).
      * @param var
@@ -219,38 +237,38 @@ public:
     // Setters
     //
 
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
     //
     // Getters
     //
 
-    virtual void writeGetterDecl(OutStream *os);
-    virtual void writeGetterImpl(OutStream *os);
+    virtual void writeGetterDecl(TextBuffer *os) const;
+    virtual void writeGetterImpl(TextBuffer *os) const;
 
     /**
      * @brief writeDecl
      * @param os
      */
-    virtual void writeDecl(OutStream *os);
+    virtual void writeDecl(TextBuffer *os) const;
 
     /**
      * @brief writeRead
      * @param os
      */
-    virtual void writeRead(OutStream *os);
+    virtual void writeRead(TextBuffer *os) const;
     /**
      * @brief writeWrite
      * @param os
      */
-    virtual void writeWrite(OutStream *os);
+    virtual void writeWrite(TextBuffer *os) const;
 
     /**
      * @brief writeFinalize Finalize on some members
      * @param os
      */
-    virtual void writeFinalize(Context &ctx);
+    virtual void writeFinalize(Context &ctx) const;
 
     //! Return the number of ident
     virtual UInt32 getIdent() const;
@@ -258,18 +276,103 @@ public:
     //! Get the read/write children prefix
     virtual String getPrefix() const;
 
+    /**
+     * @brief link Compute the names derived from the member and its children, once
+     *        parsed and before any render. The writers are const and can then run
+     *        concurrently for many profiles.
+     */
+    virtual void link();
+
     //! Get the size in byte
     virtual UInt32 getMinSize() const;
 
+    //! True if the serialized size is always getMinSize().
+    virtual Bool isFixedSize() const;
+
     //! Reference in param (reference and not copy)
     virtual Bool isRef() const;
 
+    //! True if the out type has a cheap move (std and generated types), so the setters
+    //! take an rvalue or a value to move from.
+    virtual Bool isMovable() const;
+
+    //! True if the out type owns no heap memory, so an element of an arena container
+    //! (arena = true) can be left to the arena reset.
+    virtual Bool isTriviallyDestructible() const;
+
+    /**
+     * @brief True if read and written by the functions of the DataEncoding header
+     * (variable length integers), rather than by the methods of the streams.
+     */
+    virtual Bool isEncoded() const;
+
+    //
+    // Columns (batch of records)
+    //
+
+    enum Column
+    {
+        COLUMN_NONE,     //!< nothing serialized (constants, bits, ctor...)
+        COLUMN_RAW,      //!< fixed size value, the column is copied by chunks
+        COLUMN_STREAM,   //!< variable size value, read and written one by one
+        COLUMN_ROWS      //!< not a column (loop, if, arrays, custom...), the batch is written by rows
+    };
+
+    //! Column kind of a root member into a batch of records (@see Column).
+    virtual Column getColumn() const;
+
+    /**
+     * @brief writeColumnRead Read the column of the member into records[0..count-1],
+     *        for COLUMN_RAW and COLUMN_STREAM.
+     * @param os
+     */
+    virtual void writeColumnRead(TextBuffer *os) const;
+    /**
+     * @brief writeColumnWrite Write the column of the member from records[0..count-1],
+     *        for COLUMN_RAW and COLUMN_STREAM.
+     * @param os
+     */
+    virtual void writeColumnWrite(TextBuffer *os) const;
+
+    //! Builtin type (@see BuiltinType), or -1.
+    Int32 getBuiltinType() const { return m_builtin; }
+
+    /**
+     * @brief writeReset Clear the value of a root member into reset(), keeping the
+     *        capacity of the strings and the arrays when the type allows it.
+     * @param os
+     */
+    virtual void writeReset(TextBuffer *os) const;
+
     //! get a "Set to TRUE, FALSE or any other value".
     virtual String getSetTo(const Member *param, SetValue value) const;
 
     //! Get size of the member.
     virtual String getSizeOf() const;
 
+    //
+    // Benchmark
+    //
+
+    //! Get the name used by the accessors (m_fooBar gives FooBar).
+    String getAccessorName() const;
+
+    /**
+     * @brief getBenchValue Expression of a random value for the generated benchmark,
+     *        using the rnd DataBenchRandom object.
+     * @return An empty string if the member is not randomized (default).
+     */
+    virtual String getBenchValue() const;
+
+    /**
+     * @brief writeBenchFill Write the statements setting a random content to the member,
+     *        using the editor setters of the object obj. Default only set root members
+     *        having a bench value.
+     * @param os
+     * @param obj Name of the object variable.
+     */
+    virtual void writeBenchFill(TextBuffer *os, const String &obj) const;
+
     //
     // Template
     //
@@ -305,6 +408,7 @@ public:
 protected:
 
     Member *m_parent;
+    Int32 m_builtin;
 
     String m_name;
     Bool m_public;
@@ -317,13 +421,13 @@ protected:
  * @date 2013-11-19
  * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
  */
-template <class T, UInt32 E>
+template <class T, UInt32 E, Int32 B = -1>
 class MemberHelper : public Member
 {
 public:
 
     MemberHelper(Member *parent) :
-        Member(parent)
+        Member(parent, B)
     {
 
     }
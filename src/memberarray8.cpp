@@ -8,43 +8,21 @@
  */
 
 #include "memberarray8.h"
-#include "registermember.h"
 #include <o3d/core/file.h>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberArray8>::R memberArray8;
-
 MemberArray8::MemberArray8(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberArray8::getTypeName() const
-{
-    return "array8";
-}
-
-String MemberArray8::getOutTypeName() const
-{
-    return "o3d::SmartArrayUInt8";
-}
-
-String MemberArray8::getReadMethod() const
-{
-    return "read";
-}
-
-String MemberArray8::getWriteMethod() const
-{
-    return "write";
-}
-
 T_StringList MemberArray8::getHeaders() const
 {
     T_StringList list;
     list.push_back("<o3d/core/SmartArray.h>");
+    list.push_back("<utility>");
 
     return list;
 }
@@ -60,7 +38,7 @@ UInt32 MemberArray8::getNewUIntId()
     return m_uintId.getID();
 }
 
-void MemberArray8::writeSetterDecl(OutStream *os)
+void MemberArray8::writeSetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -73,35 +51,46 @@ void MemberArray8::writeSetterDecl(OutStream *os)
     if (name.length() >= 1 && name[0] >= 'a' && name[0] <= 'z')
         name[0] = name[0] - ('a' - 'A');
 
-    line += String("void set") + name + "(const " + getOutTypeName() + " &" + mname + ")";
-    os->writeLine(line);
-    os->writeLine("    {");
-
-    // size
-    line = "        if (" + (isParent() ? getParent()->getPrefix() : "") + getName() + ".isValid())";
-    os->writeLine(line);
-    line = String("            m_messageDataSize -= ") + (isParent() ? getParent()->getPrefix() : "") + getName() + ".getSize();";
-    os->writeLine(line);
-
-    line = "        " + getName() + " = " + mname + ";";
-    os->writeLine(line);
-
-    line = String("        m_messageDataSize += ") + (isParent() ? getParent()->getPrefix() : "") + getName() + ".getSize();";
-    os->writeLine(line);
-
-    os->writeLine("    }");
-    os->writeLine("");
+    // by copy, and by move (a copy if o3d::SmartArray has no move assignment)
+    for (Int32 move = 0; move < 2; ++move)
+    {
+        if (move)
+            line = String("    void set") + name + "(" + getOutTypeName() + " &&" + mname + ")";
+        else
+            line = String("    void set") + name + "(const " + getOutTypeName() + " &" + mname + ")";
+
+        os->writeLine(line);
+        os->writeLine("    {");
+
+        // size
+        line = "        if (" + (isParent() ? getParent()->getPrefix() : "") + getName() + ".isValid())";
+        os->writeLine(line);
+        line = String("            m_messageDataSize -= ") + (isParent() ? getParent()->getPrefix() : "") + getName() + ".getSize();";
+        os->writeLine(line);
+
+        if (move)
+            line = "        " + getName() + " = std::move(" + mname + ");";
+        else
+            line = "        " + getName() + " = " + mname + ";";
+        os->writeLine(line);
+
+        line = String("        m_messageDataSize += ") + (isParent() ? getParent()->getPrefix() : "") + getName() + ".getSize();";
+        os->writeLine(line);
+
+        os->writeLine("    }");
+        os->writeLine("");
+    }
 }
 
-void MemberArray8::writeSetterImpl(OutStream *os)
+void MemberArray8::writeSetterImpl(TextBuffer *os) const
 {
 
 }
 
-void MemberArray8::writeRead(OutStream *os)
+void MemberArray8::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -122,8 +111,10 @@ void MemberArray8::writeRead(OutStream *os)
     os->writeLine(line);
     line = identStr + varSizeName + " = buffer->readUInt16();";
     os->writeLine(line);
-    // content
-    line = identStr + memberName + ".allocate(" + varSizeName + ");";
+    // content, into the array of a previous read of the same size (kept by reset)
+    line = identStr + "if (" + memberName + ".getNumElt() != " + varSizeName + ")";
+    os->writeLine(line);
+    line = identStr + "    " + memberName + ".allocate(" + varSizeName + ");";
     os->writeLine(line);
     line = identStr + "buffer->" + getReadMethod() +
             "(" +
@@ -134,10 +125,10 @@ void MemberArray8::writeRead(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberArray8::writeWrite(OutStream *os)
+void MemberArray8::writeWrite(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -163,11 +154,6 @@ void MemberArray8::writeWrite(OutStream *os)
     os->writeLine(line);
 }
 
-Bool MemberArray8::isRef() const
-{
-    return True;
-}
-
 String MemberArray8::getSetTo(const Member *param, SetValue value) const
 {
     if (value == SET_TRUE)
@@ -175,13 +161,3 @@ String MemberArray8::getSetTo(const Member *param, SetValue value) const
     else
         return ".isEmpty()";
 }
-
-UInt32 MemberArray8::getMinSize() const
-{
-    return 2;
-}
-
-String MemberArray8::getSizeOf() const
-{
-    return "2";
-}
@@ -16,36 +16,25 @@
 namespace o3d {
 namespace dmg {
 
-class MemberArray8 : public MemberHelper<MemberArray8, Member::TYPE_ARRAY8>
+class MemberArray8 : public MemberHelper<MemberArray8, Member::TYPE_ARRAY8, BT_ARRAY8>
 {
 public:
 
     MemberArray8(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
     virtual T_StringList getHeaders() const;
 
     virtual String getIfTest(const Member *param) const;
     virtual UInt32 getNewUIntId();
 
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
-
-    virtual Bool isRef() const;
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
     virtual String getSetTo(const Member *param, SetValue value) const;
 
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 
     IDManager m_uintId;
@@ -8,15 +8,12 @@
  */
 
 #include "memberbit.h"
-#include "registermember.h"
 #include <o3d/core/char.h>
 #include <o3d/core/integer.h>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberBit>::R memberBit;
-
 MemberBit::MemberBit(Member *parent) :
     MemberHelper(parent),
     m_var(nullptr)
@@ -28,27 +25,7 @@ MemberBit::~MemberBit()
 
 }
 
-String MemberBit::getTypeName() const
-{
-    return "bit";
-}
-
-String MemberBit::getOutTypeName() const
-{
-    return "o3d::UInt32";
-}
-
-String MemberBit::getReadMethod() const
-{
-    return "";
-}
-
-String MemberBit::getWriteMethod() const
-{
-    return "";
-}
-
-void MemberBit::writeDecl(OutStream *os)
+void MemberBit::writeDecl(TextBuffer *os) const
 {
     String line = "    ";
     line += String("static const ") + getOutTypeName() + " " + getName() + " = " + m_value + ";";
@@ -56,12 +33,12 @@ void MemberBit::writeDecl(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberBit::writeRead(OutStream *os)
+void MemberBit::writeRead(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberBit::writeWrite(OutStream *os)
+void MemberBit::writeWrite(TextBuffer *os) const
 {
     // nothing
 }
@@ -72,7 +49,7 @@ void MemberBit::setCond(Member *var, Member *varParam)
     m_varParam = varParam;
 }
 
-void MemberBit::writeSetterDecl(OutStream *os)
+void MemberBit::writeSetterDecl(TextBuffer *os) const
 {
     // SET
     String line("    ");
@@ -15,27 +15,21 @@
 namespace o3d {
 namespace dmg {
 
-class MemberBit : public MemberHelper<MemberBit, Member::TYPE_BIT>
+class MemberBit : public MemberHelper<MemberBit, Member::TYPE_BIT, BT_BIT>
 {
 public:
 
     MemberBit(Member *parent);
     virtual ~MemberBit();
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
+    virtual void writeDecl(TextBuffer *os) const;
 
-    virtual void writeDecl(OutStream *os);
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
     virtual void setCond(Member *var, Member *varParam);
 
-    virtual void writeSetterDecl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
 
 private:
 
@@ -8,42 +8,19 @@
  */
 
 #include "memberbitset16.h"
-#include "registermember.h"
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberBitSet16>::R memberBitSet16;
-
 MemberBitSet16::MemberBitSet16(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberBitSet16::getTypeName() const
-{
-    return "bitset16";
-}
-
-String MemberBitSet16::getOutTypeName() const
-{
-    return "o3d::BitSet16";
-}
-
-String MemberBitSet16::getReadMethod() const
-{
-    return "readUInt16";
-}
-
-String MemberBitSet16::getWriteMethod() const
-{
-    return "writeUInt16";
-}
-
-void MemberBitSet16::writeRead(OutStream *os)
+void MemberBitSet16::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -82,12 +59,12 @@ UInt32 MemberBitSet16::getNewUIntId()
     return m_uintId.getID();
 }
 
-void MemberBitSet16::writeSetterDecl(OutStream *os)
+void MemberBitSet16::writeSetterDecl(TextBuffer *os) const
 {
 
 }
 
-void MemberBitSet16::writeSetterImpl(OutStream *os)
+void MemberBitSet16::writeSetterImpl(TextBuffer *os) const
 {
 
 }
@@ -100,13 +77,3 @@ String MemberBitSet16::getSetTo(const Member *param, SetValue value) const
     else
         return ".disable(" + param->getName() + ")";
 }
-
-UInt32 MemberBitSet16::getMinSize() const
-{
-    return 2;
-}
-
-String MemberBitSet16::getSizeOf() const
-{
-    return "2";
-}
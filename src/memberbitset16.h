@@ -16,33 +16,24 @@
 namespace o3d {
 namespace dmg {
 
-class MemberBitSet16 : public MemberHelper<MemberBitSet16, Member::TYPE_BITSET16>
+class MemberBitSet16 : public MemberHelper<MemberBitSet16, Member::TYPE_BITSET16, BT_BITSET16>
 {
 public:
 
     MemberBitSet16(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual void writeRead(OutStream *os);
+    virtual void writeRead(TextBuffer *os) const;
 
     virtual T_StringList getHeaders() const;
 
     virtual String getIfTest(const Member *param) const;
     virtual UInt32 getNewUIntId();
 
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
     virtual String getSetTo(const Member *param, SetValue value) const;
 
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 
     IDManager m_uintId;
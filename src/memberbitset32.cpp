@@ -8,42 +8,19 @@
  */
 
 #include "memberbitset32.h"
-#include "registermember.h"
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberBitSet32>::R memberBitSet32;
-
 MemberBitSet32::MemberBitSet32(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberBitSet32::getTypeName() const
-{
-    return "bitset32";
-}
-
-String MemberBitSet32::getOutTypeName() const
-{
-    return "o3d::BitSet32";
-}
-
-String MemberBitSet32::getReadMethod() const
-{
-    return "readUInt32";
-}
-
-String MemberBitSet32::getWriteMethod() const
-{
-    return "writeUInt32";
-}
-
-void MemberBitSet32::writeRead(OutStream *os)
+void MemberBitSet32::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -82,12 +59,12 @@ UInt32 MemberBitSet32::getNewUIntId()
     return m_uintId.getID();
 }
 
-void MemberBitSet32::writeSetterDecl(OutStream *os)
+void MemberBitSet32::writeSetterDecl(TextBuffer *os) const
 {
 
 }
 
-void MemberBitSet32::writeSetterImpl(OutStream *os)
+void MemberBitSet32::writeSetterImpl(TextBuffer *os) const
 {
 
 }
@@ -100,13 +77,3 @@ String MemberBitSet32::getSetTo(const Member *param, SetValue value) const
     else
         return ".disable(" + param->getName() + ")";
 }
-
-UInt32 MemberBitSet32::getMinSize() const
-{
-    return 4;
-}
-
-String MemberBitSet32::getSizeOf() const
-{
-    return "4";
-}
@@ -8,42 +8,19 @@
  */
 
 #include "memberbitset64.h"
-#include "registermember.h"
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberBitSet64>::R memberBitSet64;
-
 MemberBitSet64::MemberBitSet64(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberBitSet64::getTypeName() const
-{
-    return "bitset64";
-}
-
-String MemberBitSet64::getOutTypeName() const
-{
-    return "o3d::BitSet64";
-}
-
-String MemberBitSet64::getReadMethod() const
-{
-    return "readUInt64";
-}
-
-String MemberBitSet64::getWriteMethod() const
-{
-    return "writeUInt64";
-}
-
-void MemberBitSet64::writeRead(OutStream *os)
+void MemberBitSet64::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -82,12 +59,12 @@ UInt32 MemberBitSet64::getNewUIntId()
     return m_uintId.getID();
 }
 
-void MemberBitSet64::writeSetterDecl(OutStream *os)
+void MemberBitSet64::writeSetterDecl(TextBuffer *os) const
 {
 
 }
 
-void MemberBitSet64::writeSetterImpl(OutStream *os)
+void MemberBitSet64::writeSetterImpl(TextBuffer *os) const
 {
 
 }
@@ -100,13 +77,3 @@ String MemberBitSet64::getSetTo(const Member *param, SetValue value) const
     else
         return ".disable(" + param->getName() + ")";
 }
-
-UInt32 MemberBitSet64::getMinSize() const
-{
-    return 8;
-}
-
-String MemberBitSet64::getSizeOf() const
-{
-    return "8";
-}
@@ -8,43 +8,20 @@
  */
 
 #include "memberbitset8.h"
-#include "registermember.h"
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberBitSet8>::R memberBitSet8;
-
 MemberBitSet8::MemberBitSet8(Member *parent) :
     MemberHelper(parent),
     m_uintId(0)
 {
 }
 
-String MemberBitSet8::getTypeName() const
-{
-    return "bitset8";
-}
-
-String MemberBitSet8::getOutTypeName() const
-{
-    return "o3d::BitSet8";
-}
-
-String MemberBitSet8::getReadMethod() const
-{
-    return "readUInt8";
-}
-
-String MemberBitSet8::getWriteMethod() const
-{
-    return "writeUInt8";
-}
-
-void MemberBitSet8::writeRead(OutStream *os)
+void MemberBitSet8::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -83,12 +60,12 @@ UInt32 MemberBitSet8::getNewUIntId()
     return m_uintId.getID();
 }
 
-void MemberBitSet8::writeSetterDecl(OutStream *os)
+void MemberBitSet8::writeSetterDecl(TextBuffer *os) const
 {
 
 }
 
-void MemberBitSet8::writeSetterImpl(OutStream *os)
+void MemberBitSet8::writeSetterImpl(TextBuffer *os) const
 {
 
 }
@@ -101,13 +78,3 @@ String MemberBitSet8::getSetTo(const Member *param, SetValue value) const
     else
         return ".disable(" + param->getName() + ")";
 }
-
-UInt32 MemberBitSet8::getMinSize() const
-{
-    return 1;
-}
-
-String MemberBitSet8::getSizeOf() const
-{
-    return "1";
-}
@@ -8,49 +8,16 @@
  */
 
 #include "memberbool.h"
-#include "registermember.h"
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberBool>::R memberBool;
-
 MemberBool::MemberBool(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberBool::getTypeName() const
-{
-    return "bool";
-}
-
-String MemberBool::getOutTypeName() const
-{
-    return "o3d::Bool";
-}
-
-String MemberBool::getReadMethod() const
-{
-    return "readBool";
-}
-
-String MemberBool::getWriteMethod() const
-{
-    return "writeBool";
-}
-
 String MemberBool::getSetTo() const
 {
     return " = True";
 }
-
-UInt32 MemberBool::getMinSize() const
-{
-    return 1;
-}
-
-String MemberBool::getSizeOf() const
-{
-    return "1";
-}
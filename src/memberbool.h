@@ -15,23 +15,14 @@
 namespace o3d {
 namespace dmg {
 
-class MemberBool : public MemberHelper<MemberBool, Member::TYPE_BOOL>
+class MemberBool : public MemberHelper<MemberBool, Member::TYPE_BOOL, BT_BOOL>
 {
 public:
 
     MemberBool(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
     virtual String getSetTo() const;
 
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
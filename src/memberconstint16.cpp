@@ -8,39 +8,16 @@
  */
 
 #include "memberconstint16.h"
-#include "registermember.h"
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberConstInt16>::R memberConstInt16;
-
 MemberConstInt16::MemberConstInt16(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberConstInt16::getTypeName() const
-{
-    return "const int16";
-}
-
-String MemberConstInt16::getOutTypeName() const
-{
-    return "o3d::Int16";
-}
-
-String MemberConstInt16::getReadMethod() const
-{
-    return "";
-}
-
-String MemberConstInt16::getWriteMethod() const
-{
-    return "";
-}
-
-void MemberConstInt16::writeDecl(OutStream *os)
+void MemberConstInt16::writeDecl(TextBuffer *os) const
 {
     String line = "    ";
     line += String("static const ") + getOutTypeName() + " " + getName() + " = " + m_value + ";";
@@ -48,32 +25,32 @@ void MemberConstInt16::writeDecl(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberConstInt16::writeRead(OutStream *os)
+void MemberConstInt16::writeRead(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt16::writeWrite(OutStream *os)
+void MemberConstInt16::writeWrite(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt16::writeSetterDecl(OutStream *os)
+void MemberConstInt16::writeSetterDecl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt16::writeSetterImpl(OutStream *os)
+void MemberConstInt16::writeSetterImpl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt16::writeGetterDecl(OutStream *os)
+void MemberConstInt16::writeGetterDecl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt16::writeGetterImpl(OutStream *os)
+void MemberConstInt16::writeGetterImpl(TextBuffer *os) const
 {
     // nothing
 }
@@ -15,28 +15,22 @@
 namespace o3d {
 namespace dmg {
 
-class MemberConstInt16 : public MemberHelper<MemberConstInt16, Member::TYPE_CONST_UINT32>
+class MemberConstInt16 : public MemberHelper<MemberConstInt16, Member::TYPE_CONST_UINT32, BT_CONST_INT16>
 {
 public:
 
     MemberConstInt16(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
+    virtual void writeDecl(TextBuffer *os) const;
 
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
-    virtual void writeDecl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
-
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
-
-    virtual void writeGetterDecl(OutStream *os);
-    virtual void writeGetterImpl(OutStream *os);
+    virtual void writeGetterDecl(TextBuffer *os) const;
+    virtual void writeGetterImpl(TextBuffer *os) const;
 };
 
 } // namespace dmg
@@ -8,40 +8,17 @@
  */
 
 #include "memberconstint8.h"
-#include "registermember.h"
 #include <o3d/core/file.h>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberConstInt8>::R memberConstInt8;
-
 MemberConstInt8::MemberConstInt8(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberConstInt8::getTypeName() const
-{
-    return "const int8";
-}
-
-String MemberConstInt8::getOutTypeName() const
-{
-    return "o3d::Int8";
-}
-
-String MemberConstInt8::getReadMethod() const
-{
-    return "";
-}
-
-String MemberConstInt8::getWriteMethod() const
-{
-    return "";
-}
-
-void MemberConstInt8::writeDecl(OutStream *os)
+void MemberConstInt8::writeDecl(TextBuffer *os) const
 {
     String line = "    ";
     line += String("static const ") + getOutTypeName() + " " + getName() + " = " + m_value + ";";
@@ -49,32 +26,32 @@ void MemberConstInt8::writeDecl(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberConstInt8::writeRead(OutStream *os)
+void MemberConstInt8::writeRead(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt8::writeWrite(OutStream *os)
+void MemberConstInt8::writeWrite(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt8::writeSetterDecl(OutStream *os)
+void MemberConstInt8::writeSetterDecl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt8::writeSetterImpl(OutStream *os)
+void MemberConstInt8::writeSetterImpl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt8::writeGetterDecl(OutStream *os)
+void MemberConstInt8::writeGetterDecl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstInt8::writeGetterImpl(OutStream *os)
+void MemberConstInt8::writeGetterImpl(TextBuffer *os) const
 {
     // nothing
 }
@@ -8,39 +8,16 @@
  */
 
 #include "memberconstuint32.h"
-#include "registermember.h"
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberConstUInt32>::R memberConstUInt32;
-
 MemberConstUInt32::MemberConstUInt32(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberConstUInt32::getTypeName() const
-{
-    return "const uint32";
-}
-
-String MemberConstUInt32::getOutTypeName() const
-{
-    return "o3d::UInt32";
-}
-
-String MemberConstUInt32::getReadMethod() const
-{
-    return "";
-}
-
-String MemberConstUInt32::getWriteMethod() const
-{
-    return "";
-}
-
-void MemberConstUInt32::writeDecl(OutStream *os)
+void MemberConstUInt32::writeDecl(TextBuffer *os) const
 {
     String line = "    ";
     line += String("static const ") + getOutTypeName() + " " + getName() + " = " + m_value + ";";
@@ -48,32 +25,32 @@ void MemberConstUInt32::writeDecl(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberConstUInt32::writeRead(OutStream *os)
+void MemberConstUInt32::writeRead(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstUInt32::writeWrite(OutStream *os)
+void MemberConstUInt32::writeWrite(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstUInt32::writeSetterDecl(OutStream *os)
+void MemberConstUInt32::writeSetterDecl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstUInt32::writeSetterImpl(OutStream *os)
+void MemberConstUInt32::writeSetterImpl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstUInt32::writeGetterDecl(OutStream *os)
+void MemberConstUInt32::writeGetterDecl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberConstUInt32::writeGetterImpl(OutStream *os)
+void MemberConstUInt32::writeGetterImpl(TextBuffer *os) const
 {
     // nothing
 }
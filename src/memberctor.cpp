@@ -8,14 +8,11 @@
  */
 
 #include "memberctor.h"
-#include "registermember.h"
 #include <o3d/core/char.h>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberCtor>::R memberCtor;
-
 MemberCtor::MemberCtor(Member *parent) :
     MemberHelper(parent)
 {
@@ -26,39 +23,19 @@ MemberCtor::~MemberCtor()
 {
 }
 
-String MemberCtor::getTypeName() const
-{
-    return "ctor";
-}
-
-String MemberCtor::getOutTypeName() const
-{
-    return "ctor";
-}
-
-String MemberCtor::getReadMethod() const
-{
-    return "";
-}
-
-String MemberCtor::getWriteMethod() const
-{
-    return "";
-}
-
-void MemberCtor::writeDecl(OutStream *os)
+void MemberCtor::writeDecl(TextBuffer *os) const
 {
 }
 
-void MemberCtor::writeRead(OutStream *os)
+void MemberCtor::writeRead(TextBuffer *os) const
 {
 }
 
-void MemberCtor::writeWrite(OutStream *os)
+void MemberCtor::writeWrite(TextBuffer *os) const
 {
 }
 
-void MemberCtor::writeSetterDecl(OutStream *os)
+void MemberCtor::writeSetterDecl(TextBuffer *os) const
 {
     // CTOR
     String line("    ");
@@ -73,17 +50,17 @@ void MemberCtor::writeSetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberCtor::writeSetterImpl(OutStream *os)
+void MemberCtor::writeSetterImpl(TextBuffer *os) const
 {
 
 }
 
-void MemberCtor::writeGetterDecl(OutStream *os)
+void MemberCtor::writeGetterDecl(TextBuffer *os) const
 {
 
 }
 
-void MemberCtor::writeGetterImpl(OutStream *os)
+void MemberCtor::writeGetterImpl(TextBuffer *os) const
 {
 
 }
@@ -15,29 +15,23 @@
 namespace o3d {
 namespace dmg {
 
-class MemberCtor : public MemberHelper<MemberCtor, Member::TYPE_IF>
+class MemberCtor : public MemberHelper<MemberCtor, Member::TYPE_IF, BT_CTOR>
 {
 public:
 
     MemberCtor(Member *parent);
     virtual ~MemberCtor();
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
+    virtual void writeDecl(TextBuffer *os) const;
 
-    virtual void writeDecl(OutStream *os);
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
-
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
-
-    virtual void writeGetterDecl(OutStream *os);
-    virtual void writeGetterImpl(OutStream *os);
+    virtual void writeGetterDecl(TextBuffer *os) const;
+    virtual void writeGetterImpl(TextBuffer *os) const;
 };
 
 } // namespace dmg
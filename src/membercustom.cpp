@@ -21,6 +21,8 @@ MemberCustom::MemberCustom(const MemberCustom &dup, Member *parent) :
     m_typeName(dup.m_typeName),
     m_headers(dup.m_headers),
     m_outTypeName(dup.m_outTypeName),
+    m_dataType(dup.m_dataType),
+    m_packStrings(dup.m_packStrings),
     m_templates(dup.m_templates)
 {
 
@@ -30,7 +32,9 @@ MemberCustom::MemberCustom(Member *parent) :
     Member(parent),
     m_typeName(""),
     m_headers(),
-    m_outTypeName("")
+    m_outTypeName(""),
+    m_dataType(False),
+    m_packStrings(False)
 {
 }
 
@@ -39,7 +43,7 @@ void MemberCustom::setTypeName(const String &typeName)
     m_typeName = typeName;
 }
 
-String MemberCustom::getTypeName() const
+const String& MemberCustom::getTypeName() const
 {
     return m_typeName;
 }
@@ -49,27 +53,32 @@ void MemberCustom::setOutTypeName(const String &typeName)
     m_outTypeName = typeName;
 }
 
-String MemberCustom::getOutTypeName() const
+const String& MemberCustom::getOutTypeName() const
 {
     return m_outTypeName;
 }
 
-String MemberCustom::getReadMethod() const
+const String& MemberCustom::getReadMethod() const
 {
-    return "readFromFile";
+    static const String readMethod("readFromFile");
+    return readMethod;
 }
 
-String MemberCustom::getWriteMethod() const
+const String& MemberCustom::getWriteMethod() const
 {
-    return "writeToFile";
+    static const String writeMethod("writeToFile");
+    return writeMethod;
 }
 
 T_StringList MemberCustom::getHeaders() const
 {
-    return m_headers;
+    T_StringList list = m_headers;
+    list.push_back("<utility>");
+
+    return list;
 }
 
-void MemberCustom::writeSetterDecl(OutStream *os)
+void MemberCustom::writeSetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -89,12 +98,19 @@ void MemberCustom::writeSetterDecl(OutStream *os)
     os->writeLine(line);
     os->writeLine("    }");
     os->writeLine("");
+
+    // a copy if the custom type has no move assignment
+    os->writeLine("    void set" + name + "(" + getOutTypeName() + " &&" + mname + ")");
+    os->writeLine("    {");
+    os->writeLine("        " + getName() + " = std::move(" + mname + ");");
+    os->writeLine("    }");
+    os->writeLine("");
 }
 
-void MemberCustom::writeRead(OutStream *os)
+void MemberCustom::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -107,14 +123,25 @@ void MemberCustom::writeRead(OutStream *os)
         line += "    ";
     }
 
-    line += getPrefixedName() + "." + getReadMethod() + "(is);";
+    if (m_packStrings)
+        line += getPrefixedName() + "." + getReadMethod() + "(is, strings);";
+    else
+        line += getPrefixedName() + "." + getReadMethod() + "(is);";
     os->writeLine(line);
 }
 
-void MemberCustom::writeWrite(OutStream *os)
+void MemberCustom::writeReset(TextBuffer *os) const
+{
+    if (m_dataType)
+        os->writeLine("    " + getPrefixedName() + ".reset();");
+    else
+        os->writeLine("    " + getPrefixedName() + " = " + getOutTypeName() + "();");
+}
+
+void MemberCustom::writeWrite(TextBuffer *os) const
 {    
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -127,7 +154,10 @@ void MemberCustom::writeWrite(OutStream *os)
         line += "    ";
     }
 
-    line += getPrefixedName() + "." + getWriteMethod() + "(os);";
+    if (m_packStrings)
+        line += getPrefixedName() + "." + getWriteMethod() + "(os, strings);";
+    else
+        line += getPrefixedName() + "." + getWriteMethod() + "(os);";
     os->writeLine(line);
 }
 
@@ -136,12 +166,12 @@ void MemberCustom::setHeaders(const T_StringList &headers)
     m_headers = headers;
 }
 
-void MemberCustom::writeSetterImpl(OutStream *os)
+void MemberCustom::writeSetterImpl(TextBuffer *os) const
 {
 
 }
 
-void MemberCustom::writeGetterDecl(OutStream *os)
+void MemberCustom::writeGetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -160,12 +190,12 @@ void MemberCustom::writeGetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberCustom::writeGetterImpl(OutStream *os)
+void MemberCustom::writeGetterImpl(TextBuffer *os) const
 {
 
 }
 
-void MemberCustom::writeFinalize(Context &ctx)
+void MemberCustom::writeFinalize(Context &ctx) const
 {
     ctx.os->writeLine("    " + getPrefixedName() + ".finalize();");
 }
@@ -25,27 +25,37 @@ public:
     MemberCustom(Member *parent);
 
     virtual void setTypeName(const String &typeName);
-    virtual String getTypeName() const;
+    virtual const String& getTypeName() const;
 
     virtual void setOutTypeName(const String &typeName);
-    virtual String getOutTypeName() const;
+    virtual const String& getOutTypeName() const;
 
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
+    virtual const String& getReadMethod() const;
+    virtual const String& getWriteMethod() const;
 
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
     virtual void setHeaders(const T_StringList &headers);
     virtual T_StringList getHeaders() const;
 
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
-    virtual void writeGetterDecl(OutStream *os);
-    virtual void writeGetterImpl(OutStream *os);
+    virtual void writeGetterDecl(TextBuffer *os) const;
+    virtual void writeGetterImpl(TextBuffer *os) const;
 
-    virtual void writeFinalize(Context &ctx);
+    virtual void writeFinalize(Context &ctx) const;
+
+    virtual void writeReset(TextBuffer *os) const;
+
+    //! True if the type is a data of the data files, having a reset method.
+    void setDataType(Bool dataType) { m_dataType = dataType; }
+    Bool isDataType() const { return m_dataType; }
+
+    //! Read and write a data type with the string table (pack.strings).
+    void setPackStrings(Bool packStrings) { m_packStrings = packStrings; }
+    Bool isPackStrings() const { return m_packStrings; }
 
     virtual void setTemplatesArgs(const T_StringList &args);
     virtual void setTemplate(UInt32 index, const String &value, Bool resolved);
@@ -54,6 +64,13 @@ public:
 
     virtual Bool isRef() const;
 
+    //! True for a data type, having the moves of the generated classes.
+    virtual Bool isMovable() const { return m_dataType; }
+
+    //! False for a data type (virtual destructor), a typedef class is checked when the
+    //! generated code is compiled.
+    virtual Bool isTriviallyDestructible() const { return !m_dataType; }
+
     virtual UInt32 getMinSize() const;
     virtual String getSizeOf() const;
 
@@ -70,6 +87,8 @@ protected:
     String m_typeName;
     T_StringList m_headers;
     String m_outTypeName;
+    Bool m_dataType;
+    Bool m_packStrings;
 
     struct TemplateParam
     {
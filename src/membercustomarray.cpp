@@ -15,39 +15,64 @@ using namespace o3d::dmg;
 // manual registration
 
 MemberCustomArray::MemberCustomArray(const MemberCustomArray &dup, Member *parent) :
-    MemberCustom(dup, parent)
+    MemberCustom(dup, parent),
+    m_vectorTypeName(dup.m_vectorTypeName),
+    m_varIntSize(dup.m_varIntSize),
+    m_arena(dup.m_arena)
 {
 
 }
 
 MemberCustomArray::MemberCustomArray(Member *parent) :
-    MemberCustom(parent)
+    MemberCustom(parent),
+    m_varIntSize(False),
+    m_arena(False)
 {
     m_headers.push_back("<vector>");
+    m_headers.push_back("<utility>");
 }
 
-String MemberCustomArray::getOutTypeName() const
+void MemberCustomArray::setOutTypeName(const String &typeName)
 {
-    return "std::vector<" + m_outTypeName + ">";
+    m_outTypeName = typeName;
+    setArena(m_arena);
 }
 
-String MemberCustomArray::getReadMethod() const
+void MemberCustomArray::setArena(Bool arena)
 {
-    return "";
+    m_arena = arena;
+
+    if (m_arena)
+        m_vectorTypeName = "std::vector<" + m_outTypeName + ", DataArenaAllocator<" + m_outTypeName + "> >";
+    else
+        m_vectorTypeName = "std::vector<" + m_outTypeName + ">";
+}
+
+const String& MemberCustomArray::getOutTypeName() const
+{
+    return m_vectorTypeName;
+}
+
+const String& MemberCustomArray::getReadMethod() const
+{
+    static const String none;
+    return none;
 }
 
-String MemberCustomArray::getWriteMethod() const
+const String& MemberCustomArray::getWriteMethod() const
 {
-    return "";
+    static const String none;
+    return none;
 }
 
 void MemberCustomArray::setHeaders(const T_StringList &headers)
 {
     m_headers = headers;
     m_headers.push_back("<vector>");
+    m_headers.push_back("<utility>");
 }
 
-void MemberCustomArray::writeSetterDecl(OutStream *os)
+void MemberCustomArray::writeSetterDecl(TextBuffer *os) const
 {
     String identStr("    ");
 
@@ -67,6 +92,12 @@ void MemberCustomArray::writeSetterDecl(OutStream *os)
     os->writeLine(identStr + "}");
     os->writeLine("");
 
+    os->writeLine(identStr + "void set" + name + "(" + getOutTypeName() + " &&" + mname + ")");
+    os->writeLine(identStr + "{");
+    os->writeLine(identStr + identStr + getPrefixedName() + " = std::move(" + mname + ");");
+    os->writeLine(identStr + "}");
+    os->writeLine("");
+
     // and add a write getter
     os->writeLine(identStr + getOutTypeName() + "& get" + name + "()");
     os->writeLine(identStr + "{");
@@ -75,10 +106,10 @@ void MemberCustomArray::writeSetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberCustomArray::writeRead(OutStream *os)
+void MemberCustomArray::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -100,19 +131,39 @@ void MemberCustomArray::writeRead(OutStream *os)
     String prefixedName = getPrefixedName();
 
     os->writeLine(identStr + "o3d::UInt32 " + counter + " = 0;");
-    os->writeLine(identStr + counter + " = is.readUInt32();");
+    if (m_varIntSize)
+        os->writeLine(identStr + counter + " = readVarUInt32(is);");
+    else
+        os->writeLine(identStr + counter + " = is.readUInt32();");
+
+    // arena = true, no capacity of another arena, or of the same one before its reset
+    if (m_arena)
+    {
+        os->writeLine(identStr + "if (" + prefixedName + ".get_allocator() != DataArenaAllocator<" + m_outTypeName + ">())");
+        os->writeLine(identStr + "    " + prefixedName + " = " + m_vectorTypeName + "();");
+    }
+
     os->writeLine(identStr + prefixedName + ".resize(" + counter + ");");
     os->writeLine(identStr + "for (o3d::UInt32 i = 0; i < " + counter + "; ++i)");
     os->writeLine(identStr + "{");
-    os->writeLine(identStr + identStr + prefixedName + "[i].readFromFile(is);");
+    if (m_packStrings)
+        os->writeLine(identStr + identStr + prefixedName + "[i].readFromFile(is, strings);");
+    else
+        os->writeLine(identStr + identStr + prefixedName + "[i].readFromFile(is);");
     os->writeLine(identStr + "}");
     os->writeLine(identStr);
 }
 
-void MemberCustomArray::writeWrite(OutStream *os)
+void MemberCustomArray::writeReset(TextBuffer *os) const
+{
+    // the capacity is kept for the next read
+    os->writeLine("    " + getPrefixedName() + ".clear();");
+}
+
+void MemberCustomArray::writeWrite(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -135,23 +186,30 @@ void MemberCustomArray::writeWrite(OutStream *os)
 
     os->writeLine(identStr + "o3d::UInt32 " + counter + " = 0;");
     os->writeLine(identStr + counter + " = (o3d::UInt32)" + prefixedName + ".size();");
-    os->writeLine(identStr + "is.writeUInt32(" + counter + ");");
+    if (m_varIntSize)
+        os->writeLine(identStr + "writeVarUInt32(os, " + counter + ");");
+    else
+        os->writeLine(identStr + "os.writeUInt32(" + counter + ");");
+
     os->writeLine(identStr + "for (o3d::UInt32 i = 0; i < " + counter + "; ++i)");
     os->writeLine(identStr + "{");
-    os->writeLine(identStr + identStr + prefixedName + "[i].writeToFile(os);");
+    if (m_packStrings)
+        os->writeLine(identStr + identStr + prefixedName + "[i].writeToFile(os, strings);");
+    else
+        os->writeLine(identStr + identStr + prefixedName + "[i].writeToFile(os);");
     os->writeLine(identStr + "}");
     os->writeLine(identStr);
 }
 
-void MemberCustomArray::writeSetterImpl(OutStream *os)
+void MemberCustomArray::writeSetterImpl(TextBuffer *os) const
 {
 
 }
 
-void MemberCustomArray::writeFinalize(Context &ctx)
+void MemberCustomArray::writeFinalize(Context &ctx) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -174,7 +232,8 @@ void MemberCustomArray::writeFinalize(Context &ctx)
 
 UInt32 MemberCustomArray::getMinSize() const
 {
-    return 2;
+    // the size prefix
+    return m_varIntSize ? 1 : 4;
 }
 
 String MemberCustomArray::getSizeOf() const
@@ -27,22 +27,40 @@ public:
 
     MemberCustomArray(Member *parent);
 
-    virtual String getOutTypeName() const;
+    //! Set the type of an element, the out type name is a vector of it.
+    virtual void setOutTypeName(const String &typeName);
+    virtual const String& getOutTypeName() const;
 
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
+    virtual const String& getReadMethod() const;
+    virtual const String& getWriteMethod() const;
 
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
-    virtual void writeFinalize(Context &ctx);
+    virtual void writeFinalize(Context &ctx) const;
+
+    virtual void writeReset(TextBuffer *os) const;
+
+    virtual Bool isMovable() const { return True; }
+    virtual Bool isTriviallyDestructible() const { return False; }
 
     virtual UInt32 getMinSize() const;
     virtual String getSizeOf() const;
 
+    //! Write the size prefix as a variable length integer (@encoding sizes = varint).
+    void setVarIntSize(Bool varIntSize) { m_varIntSize = varIntSize; }
+    Bool isVarIntSize() const { return m_varIntSize; }
+
+    //! Allocate the elements by DataArenaAllocator (arena = true).
+    void setArena(Bool arena);
+    Bool isArena() const { return m_arena; }
+
+    //! True with a variable length size prefix.
+    virtual Bool isEncoded() const { return m_varIntSize; }
+
     void setHeaders(const T_StringList &headers);
 
     virtual UInt32 getType() const { return (UInt32)Member::TYPE_CUSTOM_ARRAY; }
@@ -52,6 +70,12 @@ public:
 
     // we want a clone
     virtual Member* makeInstance(Member *parent) const { return new MemberCustomArray(*this, parent); }
+
+private:
+
+    String m_vectorTypeName;
+    Bool m_varIntSize;
+    Bool m_arena;
 };
 
 } // namespace dmg
@@ -19,7 +19,8 @@ using namespace o3d::dmg;
 MemberCustomRef::MemberCustomRef(const MemberCustomRef &dup, Member *parent) :
     MemberCustom(dup, parent),
     m_ref(nullptr),
-    m_refData(dup.m_refData)
+    m_refData(dup.m_refData),
+    m_pointerTypeName(dup.m_pointerTypeName)
 {
 
 }
@@ -46,10 +47,10 @@ void MemberCustomRef::setRefData(Data *data)
     m_refData = data;
 }
 
-void MemberCustomRef::writeDecl(OutStream *os)
+void MemberCustomRef::writeDecl(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -69,7 +70,7 @@ void MemberCustomRef::writeDecl(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberCustomRef::writeSetterDecl(OutStream *os)
+void MemberCustomRef::writeSetterDecl(TextBuffer *os) const
 {
     String identStr("    ");
 
@@ -102,22 +103,28 @@ void MemberCustomRef::writeSetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberCustomRef::writeRead(OutStream *os)
+void MemberCustomRef::writeRead(TextBuffer *os) const
 {
     m_ref->writeRead(os);
 }
 
-void MemberCustomRef::writeWrite(OutStream *os)
+void MemberCustomRef::writeWrite(TextBuffer *os) const
 {
     m_ref->writeWrite(os);
 }
 
-void MemberCustomRef::writeSetterImpl(OutStream *os)
+void MemberCustomRef::writeReset(TextBuffer *os) const
+{
+    os->writeLine("    " + getPrefixedName() + " = nullptr;");
+    m_ref->writeReset(os);
+}
+
+void MemberCustomRef::writeSetterImpl(TextBuffer *os) const
 {
     // nothing
 }
 
-void MemberCustomRef::writeGetterDecl(OutStream *os)
+void MemberCustomRef::writeGetterDecl(TextBuffer *os) const
 {
     String identStr("    ");
 
@@ -149,17 +156,33 @@ void MemberCustomRef::writeGetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberCustomRef::writeGetterImpl(OutStream *os)
+void MemberCustomRef::writeGetterImpl(TextBuffer *os) const
 {
 
 }
 
-String MemberCustomRef::getOutTypeName() const
+void MemberCustomRef::setOutTypeName(const String &typeName)
 {
-    return "const " + m_outTypeName + "*";
+    m_outTypeName = typeName;
+    m_pointerTypeName = "const " + m_outTypeName + "*";
 }
 
-void MemberCustomRef::writeFinalize(Context &ctx)
+const String& MemberCustomRef::getOutTypeName() const
+{
+    return m_pointerTypeName;
+}
+
+void MemberCustomRef::writeBenchFill(TextBuffer *os, const String &obj) const
+{
+    // only the identifier is serialized
+    String value = m_ref->getBenchValue();
+    if (value.isEmpty() || isParent())
+        return;
+
+    os->writeLine("    " + obj + ".set" + getAccessorName() + "Id(" + value + ");");
+}
+
+void MemberCustomRef::writeFinalize(Context &ctx) const
 {
     String method;
     String methodType = ".";
@@ -173,7 +196,7 @@ void MemberCustomRef::writeFinalize(Context &ctx)
         String tplStr = "";
 
         UInt32 n = 0;
-        for (TemplateParam &tpl : m_templates)
+        for (const TemplateParam &tpl : m_templates)
         {
             tplStr += tpl.value;
 
@@ -256,6 +279,11 @@ UInt32 MemberCustomRef::getMinSize() const
     return m_ref->getMinSize();
 }
 
+Bool MemberCustomRef::isFixedSize() const
+{
+    return m_ref->isFixedSize();
+}
+
 String MemberCustomRef::getSizeOf() const
 {
     return m_ref->getSizeOf();
@@ -28,20 +28,26 @@ public:
 
     virtual ~MemberCustomRef();
 
-    virtual void writeDecl(OutStream *os);
+    virtual void writeDecl(TextBuffer *os) const;
 
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
-    virtual void writeGetterDecl(OutStream *os);
-    virtual void writeGetterImpl(OutStream *os);
+    virtual void writeGetterDecl(TextBuffer *os) const;
+    virtual void writeGetterImpl(TextBuffer *os) const;
 
-    virtual String getOutTypeName() const;
+    //! Set the type of the referenced data, the out type name is a const pointer to it.
+    virtual void setOutTypeName(const String &typeName);
+    virtual const String& getOutTypeName() const;
 
-    virtual void writeFinalize(Context &ctx);
+    virtual void writeFinalize(Context &ctx) const;
+
+    virtual void writeReset(TextBuffer *os) const;
+
+    virtual void writeBenchFill(TextBuffer *os, const String &obj) const;
 
     void setHeaders(const T_StringList &headers);
 
@@ -54,8 +60,10 @@ public:
      */
     virtual void setRefMember(Member *ref);
     virtual Bool isRef() const;
+    virtual Bool isMovable() const { return False; }
 
     virtual UInt32 getMinSize() const;
+    virtual Bool isFixedSize() const;
     virtual String getSizeOf() const;
 
     virtual UInt32 getType() const { return (UInt32)Member::TYPE_CUSTOM_REF; }
@@ -70,6 +78,8 @@ protected:
 
     Member *m_ref;
     Data *m_refData;
+
+    String m_pointerTypeName;
 };
 
 } // namespace dmg
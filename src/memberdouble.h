@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberDouble : public MemberHelper<MemberDouble, Member::TYPE_DOUBLE>
+class MemberDouble : public MemberHelper<MemberDouble, Member::TYPE_DOUBLE, BT_DOUBLE>
 {
 public:
 
     MemberDouble(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
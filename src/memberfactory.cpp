@@ -10,23 +10,85 @@
 #include "memberfactory.h"
 #include <o3d/core/debug.h>
 
+#include "memberarray8.h"
+#include "memberbit.h"
+#include "memberbitset16.h"
+#include "memberbitset32.h"
+#include "memberbitset64.h"
+#include "memberbitset8.h"
+#include "memberbool.h"
+#include "memberconstint16.h"
+#include "memberconstint8.h"
+#include "memberconstuint32.h"
+#include "memberctor.h"
+#include "memberdouble.h"
+#include "memberfixedstring.h"
+#include "memberfloat.h"
+#include "memberif.h"
+#include "memberimmediate.h"
+#include "memberint16.h"
+#include "memberint32.h"
+#include "memberint64.h"
+#include "memberint8.h"
+#include "memberloop.h"
+#include "memberstaticarrayuint32.h"
+#include "memberstaticarrayuint8.h"
+#include "memberstring.h"
+#include "memberstringview.h"
+#include "memberuint16.h"
+#include "memberuint32.h"
+#include "memberuint64.h"
+#include "memberuint8.h"
+#include "memberutf8string.h"
+#include "membervarint32.h"
+#include "membervarint64.h"
+#include "membervaruint32.h"
+#include "membervaruint64.h"
+
 using namespace o3d;
 using namespace o3d::dmg;
 
-MemberFactory* MemberFactory::ms_instance = nullptr;
-
-MemberFactory* MemberFactory::instance()
-{
-    if (ms_instance == nullptr)
-        ms_instance = new MemberFactory;
+namespace {
 
-    return ms_instance;
-}
+//! Builders of the builtin types, indexed by BuiltinType.
+static Member* (* const builtinCreators[NUM_BUILTIN_TYPES])(Member *parent) = {
+    &MemberArray8::createInstance,
+    &MemberBit::createInstance,
+    &MemberBitSet16::createInstance,
+    &MemberBitSet32::createInstance,
+    &MemberBitSet64::createInstance,
+    &MemberBitSet8::createInstance,
+    &MemberBool::createInstance,
+    &MemberConstInt16::createInstance,
+    &MemberConstInt8::createInstance,
+    &MemberConstUInt32::createInstance,
+    &MemberCtor::createInstance,
+    &MemberDouble::createInstance,
+    &MemberFloat::createInstance,
+    &MemberIf::createInstance,
+    &MemberImmediate::createInstance,
+    &MemberInt16::createInstance,
+    &MemberInt32::createInstance,
+    &MemberInt64::createInstance,
+    &MemberInt8::createInstance,
+    &MemberLoop::createInstance,
+    &MemberString::createInstance,
+    &MemberFixedString::createInstance,
+    &MemberStringView::createInstance,
+    &MemberUInt16::createInstance,
+    &MemberUInt32::createInstance,
+    &MemberStaticArrayUInt32::createInstance,
+    &MemberUInt64::createInstance,
+    &MemberUInt8::createInstance,
+    &MemberStaticArrayUInt8::createInstance,
+    &MemberUtf8String::createInstance,
+    &MemberVarInt32::createInstance,
+    &MemberVarInt64::createInstance,
+    &MemberVarUInt32::createInstance,
+    &MemberVarUInt64::createInstance
+};
 
-void MemberFactory::destroy()
-{
-    deletePtr(ms_instance);
-}
+} // anonymous namespace
 
 MemberFactory::MemberFactory()
 {
@@ -35,6 +97,12 @@ MemberFactory::MemberFactory()
 void MemberFactory::registerMember(Member *member)
 {
     String typeName = member->getTypeName();
+    if (isBuiltin(typeName))
+    {
+        deletePtr(member);
+        O3D_ERROR(E_InvalidParameter("Type name " + typeName + " is a builtin type"));
+    }
+
     if (m_members.find(typeName) != m_members.end())
     {
         deletePtr(m_members[typeName]);
@@ -51,12 +119,20 @@ MemberFactory::~MemberFactory()
     }
 }
 
-Member* MemberFactory::buildFromTypeName(const String &typeName, Member *parent)
+Bool MemberFactory::isBuiltin(const String &typeName)
 {
-    auto it = m_members.find(typeName);
+    return findBuiltinType(typeName) >= 0;
+}
 
+Member* MemberFactory::buildFromTypeName(const String &typeName, Member *parent) const
+{
+    Int32 builtin = findBuiltinType(typeName);
+    if (builtin >= 0)
+        return builtinCreators[builtin](parent);
+
+    auto it = m_members.find(typeName);
     if (it != m_members.end())
         return it->second->makeInstance(parent);
-    else
-        O3D_ERROR(E_InvalidParameter("Unsuported type name " + typeName));
+
+    O3D_ERROR(E_InvalidParameter("Unsuported type name " + typeName));
 }
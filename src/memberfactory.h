@@ -16,25 +16,33 @@
 namespace o3d {
 namespace dmg {
 
+/**
+ * @brief Build members by type name.
+ * A generator owns its factory, where the types declared by the parsed files
+ * (typedef and data) are registered. The builtin types (bool, int32, string,
+ * loop, if...) come from a constant table of descriptors (@see TypeDescriptor),
+ * found by a perfect hash of the type name before the registered ones, so there
+ * is nothing to register nor to allocate at startup, and many generators can run
+ * concurrently.
+ */
 class MemberFactory
 {
 public:
 
+    MemberFactory();
+
     virtual ~MemberFactory();
-    virtual Member* buildFromTypeName(const String &type, Member *parent);
+    virtual Member* buildFromTypeName(const String &type, Member *parent) const;
 
+    //! Register a declared type, owned by the factory. A builtin type name is refused.
     void registerMember(Member *member);
 
-    static MemberFactory* instance();
-    static void destroy();
+    //! True if a type name is a builtin type.
+    static Bool isBuiltin(const String &typeName);
 
 private:
 
-    MemberFactory();
-
     StringMap<Member*> m_members;
-
-    static MemberFactory *ms_instance;
 };
 
 } // namespace o3d
@@ -0,0 +1,60 @@
+/**
+ * @file memberfixedstring.cpp
+ * @brief Bounded string member, string<N>, stored inline.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#include "memberfixedstring.h"
+#include <o3d/core/debug.h>
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+MemberFixedString::MemberFixedString(Member *parent) :
+    MemberHelper(parent),
+    m_capacity(0)
+{
+}
+
+const String& MemberFixedString::getOutTypeName() const
+{
+    return m_outTypeName;
+}
+
+const String& MemberFixedString::getReadMethod() const
+{
+    return m_readMethod;
+}
+
+String MemberFixedString::getSizeOf() const
+{
+    return getName() + ".length() + 1";
+}
+
+void MemberFixedString::setTemplate(UInt32 index, const String &value, Bool resolved)
+{
+    if (index != 0)
+        O3D_ERROR(E_InvalidFormat("string<N> takes a single capacity"));
+
+    UInt32 capacity = 0;
+    for (UInt32 i = 0; i < value.length(); ++i)
+    {
+        if (value[i] < '0' || value[i] > '9' || capacity > 255)
+        {
+            capacity = 0;
+            break;
+        }
+
+        capacity = capacity * 10 + (UInt32)(value[i] - '0');
+    }
+
+    if (capacity < 1 || capacity > 255)
+        O3D_ERROR(E_InvalidFormat("string<N> capacity must be an integer from 1 to 255"));
+
+    m_capacity = capacity;
+    m_outTypeName = String::print("DataFixedString<%u>", capacity);
+    m_readMethod = String::print("readFixedString<%u>", capacity);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file memberfixedstring.h
+ * @brief Bounded string member, string<N>, stored inline.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#ifndef _O3D_DMG_MEMBERFIXEDSTRING_H
+#define _O3D_DMG_MEMBERFIXEDSTRING_H
+
+#include "member.h"
+
+namespace o3d {
+namespace dmg {
+
+/**
+ * @brief A DataFixedString<N> (DataEncoding header), an inline buffer of N UTF-8 bytes
+ * and a length byte, so N is 1 to 255. Written as the length byte then the bytes.
+ */
+class MemberFixedString : public MemberHelper<MemberFixedString, Member::TYPE_FIXED_STRING, BT_FIXED_STRING>
+{
+public:
+
+    MemberFixedString(Member *parent);
+
+    virtual const String& getOutTypeName() const;
+    virtual const String& getReadMethod() const;
+
+    virtual String getSizeOf() const;
+
+    //! The capacity N, from string<N>.
+    virtual void setTemplate(UInt32 index, const String &value, Bool resolved);
+
+    UInt32 getCapacity() const { return m_capacity; }
+
+private:
+
+    UInt32 m_capacity;
+
+    String m_outTypeName;
+    String m_readMethod;
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_MEMBERFIXEDSTRING_H
@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberFloat : public MemberHelper<MemberFloat, Member::TYPE_FLOAT>
+class MemberFloat : public MemberHelper<MemberFloat, Member::TYPE_FLOAT, BT_FLOAT>
 {
 public:
 
     MemberFloat(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
@@ -8,15 +8,12 @@
  */
 
 #include "memberif.h"
-#include "registermember.h"
 #include <o3d/core/char.h>
 #include <o3d/core/integer.h>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberIf>::R memberIf;
-
 MemberIf::MemberIf(Member *parent) :
     MemberHelper(parent),
     m_var(nullptr)
@@ -31,39 +28,28 @@ MemberIf::~MemberIf()
     }
 }
 
-String MemberIf::getTypeName() const
+void MemberIf::writeDecl(TextBuffer *os) const
 {
-    return "if";
-}
-
-String MemberIf::getOutTypeName() const
-{
-    return "if";
-}
-
-String MemberIf::getReadMethod() const
-{
-    return "";
-}
-
-String MemberIf::getWriteMethod() const
-{
-    return "";
+    // write children
+    for (Member *member : m_members)
+    {
+        member->writeDecl(os);
+    }
 }
 
-void MemberIf::writeDecl(OutStream *os)
+void MemberIf::writeReset(TextBuffer *os) const
 {
-    // write children
+    // the members of the condition are members of the class
     for (Member *member : m_members)
     {
-        member->writeDecl(os);
+        member->writeReset(os);
     }
 }
 
-void MemberIf::writeRead(OutStream *os)
+void MemberIf::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -94,10 +80,10 @@ void MemberIf::writeRead(OutStream *os)
     os->writeLine(identStr + "}");
 }
 
-void MemberIf::writeWrite(OutStream *os)
+void MemberIf::writeWrite(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -140,6 +126,14 @@ void MemberIf::addMember(Member *member)
     m_members.push_back(member);
 }
 
+void MemberIf::link()
+{
+    for (Member *member : m_members)
+    {
+        member->link();
+    }
+}
+
 Member *MemberIf::findMember(const String &name) const
 {
     for (Member *child : m_members)
@@ -159,28 +153,12 @@ UInt32 MemberIf::getIdent() const
     return 1;
 }
 
-void MemberIf::writeSetterDecl(OutStream *os)
+void MemberIf::writeSetterDecl(TextBuffer *os) const
 {
     // SET
     String line("    ");
 
-    String name = m_var->getName();
-    if (name.startsWith("m_"))
-        name.remove(0, 2);
-    if (name.length() >= 1)
-        name[0] = WideChar::toUpper(name[0]);
-
-    String pname = m_varParam->getName();
-    pname.lower();
-    pname[0] = WideChar::toUpper(pname[0]);
-    Int32 p;
-    while ((p = pname.find('_')) != -1)
-    {
-        pname.remove(p, 1);
-        pname[p] = WideChar::toUpper(pname[p]);
-    }
-
-    name += pname;
+    String name = getSetterName();
 
     line += String("void set") + name + "(";
 
@@ -250,9 +228,9 @@ void MemberIf::writeSetterDecl(OutStream *os)
         line = String("        ") + member->getName() + " = " + mname + ";";
         os->writeLine(line);
 
-        if (UInteger32::isInteger(member->getSizeOf()))
+        if (member->isFixedSize())
         {
-            intSize += UInteger32::parseInteger(member->getSizeOf());
+            intSize += member->getMinSize();
         }
         else
         {
@@ -337,7 +315,51 @@ void MemberIf::writeSetterDecl(OutStream *os)
     }
 }
 
-void MemberIf::writeSetterImpl(OutStream *os)
+void MemberIf::writeSetterImpl(TextBuffer *os) const
+{
+
+}
+
+void MemberIf::writeBenchFill(TextBuffer *os, const String &obj) const
+{
+    // only for a root condition on a bitset, without inner loop or condition
+    if (isParent() || !m_varParam)
+        return;
+
+    String values;
+    for (Member *member : m_members)
+    {
+        String value = member->getBenchValue();
+        if (value.isEmpty())
+            return;
+
+        if (values.isValid())
+            values += ", ";
+
+        values += value;
+    }
+
+    os->writeLine("    if (rnd.nextBool())");
+    os->writeLine("        " + obj + ".set" + getSetterName() + "(" + values + ");");
+}
+
+String MemberIf::getSetterName() const
 {
+    String name = m_var->getName();
+    if (name.startsWith("m_"))
+        name.remove(0, 2);
+    if (name.length() >= 1)
+        name[0] = WideChar::toUpper(name[0]);
+
+    String pname = m_varParam->getName();
+    pname.lower();
+    pname[0] = WideChar::toUpper(pname[0]);
+    Int32 p;
+    while ((p = pname.find('_')) != -1)
+    {
+        pname.remove(p, 1);
+        pname[p] = WideChar::toUpper(pname[p]);
+    }
 
+    return name + pname;
 }
@@ -15,32 +15,34 @@
 namespace o3d {
 namespace dmg {
 
-class MemberIf : public MemberHelper<MemberIf, Member::TYPE_IF>
+class MemberIf : public MemberHelper<MemberIf, Member::TYPE_IF, BT_IF>
 {
 public:
 
     MemberIf(Member *parent);
     virtual ~MemberIf();
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
+    virtual void writeDecl(TextBuffer *os) const;
 
-    virtual void writeDecl(OutStream *os);
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
+    virtual void writeReset(TextBuffer *os) const;
 
     virtual void setCond(Member *var, Member *varParam);
     virtual void addMember(Member *member);
     virtual Member* findMember(const String &name) const;
 
+    virtual void link();
+
     virtual UInt32 getIdent() const;
 
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
+
+    virtual void writeBenchFill(TextBuffer *os, const String &obj) const;
+
+    virtual const std::list<Member*>* getChildren() const { return &m_members; }
 
 private:
 
@@ -48,6 +50,9 @@ private:
     Member *m_varParam;
 
     std::list<Member*> m_members;
+
+    //! Name of the setter, without the set prefix (m_flags[HAS_NAME] gives FlagsHasName).
+    String getSetterName() const;
 };
 
 } // namespace dmg
@@ -8,59 +8,36 @@
  */
 
 #include "memberimmediate.h"
-#include "registermember.h"
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberImmediate>::R memberImmediate;
-
 MemberImmediate::MemberImmediate(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberImmediate::getTypeName() const
-{
-    return "immediate";
-}
-
-String MemberImmediate::getOutTypeName() const
-{
-    return "";
-}
-
-String MemberImmediate::getReadMethod() const
-{
-    return "";
-}
-
-String MemberImmediate::getWriteMethod() const
-{
-    return "";
-}
-
-void MemberImmediate::writeDecl(OutStream *os)
+void MemberImmediate::writeDecl(TextBuffer *os) const
 {
 
 }
 
-void MemberImmediate::writeRead(OutStream *os)
+void MemberImmediate::writeRead(TextBuffer *os) const
 {
 
 }
 
-void MemberImmediate::writeWrite(OutStream *os)
+void MemberImmediate::writeWrite(TextBuffer *os) const
 {
 
 }
 
-void MemberImmediate::writeSetterDecl(OutStream *os)
+void MemberImmediate::writeSetterDecl(TextBuffer *os) const
 {
 
 }
 
-void MemberImmediate::writeSetterImpl(OutStream *os)
+void MemberImmediate::writeSetterImpl(TextBuffer *os) const
 {
 
 }
@@ -18,25 +18,19 @@ namespace dmg {
 /**
  * @brief The MemberImmediate have its name for the immediate value.
  */
-class MemberImmediate : public MemberHelper<MemberImmediate, Member::TYPE_IMMEDIATE_UINT32>
+class MemberImmediate : public MemberHelper<MemberImmediate, Member::TYPE_IMMEDIATE_UINT32, BT_IMMEDIATE>
 {
 public:
 
     MemberImmediate(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
+    virtual void writeDecl(TextBuffer *os) const;
 
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
-    virtual void writeDecl(OutStream *os);
-
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
-
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 };
 
 } // namespace dmg
@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberInt16 : public MemberHelper<MemberInt16, Member::TYPE_INT16>
+class MemberInt16 : public MemberHelper<MemberInt16, Member::TYPE_INT16, BT_INT16>
 {
 public:
 
     MemberInt16(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
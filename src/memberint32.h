@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberInt32 : public MemberHelper<MemberInt32, Member::TYPE_INT32>
+class MemberInt32 : public MemberHelper<MemberInt32, Member::TYPE_INT32, BT_INT32>
 {
 public:
 
     MemberInt32(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberInt64 : public MemberHelper<MemberInt64, Member::TYPE_INT64>
+class MemberInt64 : public MemberHelper<MemberInt64, Member::TYPE_INT64, BT_INT64>
 {
 public:
 
     MemberInt64(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
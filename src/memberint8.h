@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberInt8 : public MemberHelper<MemberInt8, Member::TYPE_INT8>
+class MemberInt8 : public MemberHelper<MemberInt8, Member::TYPE_INT8, BT_INT8>
 {
 public:
 
     MemberInt8(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
@@ -8,52 +8,31 @@
  */
 
 #include "memberloop.h"
-#include "registermember.h"
 #include <o3d/core/char.h>
 #include <o3d/core/integer.h>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberLoop>::R memberLoop;
-
 MemberLoop::MemberLoop(Member *parent) :
-    MemberHelper(parent)
-{
-}
-
-String MemberLoop::getTypeName() const
-{
-    return "loop";
-}
-
-String MemberLoop::getOutTypeName() const
+    MemberHelper(parent),
+    m_arena(False)
 {
-    return "loop";
 }
 
 T_StringList MemberLoop::getHeaders() const
 {
     T_StringList list;
     list.push_back("<o3d/core/SmartArray.h>");
+    list.push_back("<utility>");
 
     return list;
 }
 
-String MemberLoop::getReadMethod() const
-{
-    return "";
-}
-
-String MemberLoop::getWriteMethod() const
-{
-    return "";
-}
-
-void MemberLoop::writeDecl(OutStream *os)
+void MemberLoop::writeDecl(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -77,18 +56,16 @@ void MemberLoop::writeDecl(OutStream *os)
 
     os->writeLine(identStr + "};");
 
-    m_arrayName = getName();
-    m_arrayName.lower();
-    m_arrayName.insert("m_", 0);
-    m_arrayName.concat("sArray");
-
-    os->writeLine(identStr + "o3d::SmartArray<" + getName() + "> "  + m_arrayName + ";");
+    if (m_arena)
+        os->writeLine(identStr + "DataArenaArray<" + getName() + "> "  + m_arrayName + ";");
+    else
+        os->writeLine(identStr + "o3d::SmartArray<" + getName() + "> "  + m_arrayName + ";");
 }
 
-void MemberLoop::writeRead(OutStream *os)
+void MemberLoop::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -103,8 +80,17 @@ void MemberLoop::writeRead(OutStream *os)
 
     os->writeLine("");
 
-    String resize = identStr + m_arrayName + ".allocate(" + m_var->getName() + ");";
-    os->writeLine(resize);
+    // reuse the elements of a previous read of the same count, and with arena = true
+    // the storage if from the current arena since its last reset
+    if (m_arena)
+    {
+        os->writeLine(identStr + m_arrayName + ".allocate(" + m_var->getName() + ");");
+    }
+    else
+    {
+        os->writeLine(identStr + "if (" + m_arrayName + ".getNumElt() != " + m_var->getName() + ")");
+        os->writeLine(identStr + "    " + m_arrayName + ".allocate(" + m_var->getName() + ");");
+    }
 
     String loop = identStr + "for (";
     loop += m_var->getOutTypeName() + " i = 0; i < " + m_var->getName() + "; ++i)";
@@ -121,10 +107,37 @@ void MemberLoop::writeRead(OutStream *os)
     os->writeLine(identStr + "}");
 }
 
-void MemberLoop::writeWrite(OutStream *os)
+void MemberLoop::writeReset(TextBuffer *os) const
+{
+    // the storage is kept for a read from the same arena, dropped if it was reset since
+    if (m_arena)
+    {
+        os->writeLine("    " + m_arrayName + ".clear();");
+        return;
+    }
+
+    // the elements are kept for a read of the same count, their values cleared
+    TextBuffer children;
+    for (Member *member : m_members)
+    {
+        member->writeReset(&children);
+    }
+
+    os->writeLine("    for (o3d::UInt32 i = 0; i < " + m_arrayName + ".getNumElt(); ++i)");
+    os->writeLine("    {");
+
+    for (const String &line : children.getLines())
+    {
+        os->writeLine("    " + line);
+    }
+
+    os->writeLine("    }");
+}
+
+void MemberLoop::writeWrite(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -165,6 +178,19 @@ void MemberLoop::addMember(Member *member)
     m_members.push_back(member);
 }
 
+void MemberLoop::link()
+{
+    m_arrayName = getName();
+    m_arrayName.lower();
+    m_arrayName.insert("m_", 0);
+    m_arrayName.concat("sArray");
+
+    for (Member *member : m_members)
+    {
+        member->link();
+    }
+}
+
 Member *MemberLoop::findMember(const String &name) const
 {
     for (Member *child : m_members)
@@ -189,7 +215,7 @@ String MemberLoop::getPrefix() const
     return m_arrayName + "[i].";
 }
 
-void MemberLoop::writeSetterDecl(OutStream *os)
+void MemberLoop::writeSetterDecl(TextBuffer *os) const
 {
     // SET
     String line("    ");
@@ -257,7 +283,10 @@ void MemberLoop::writeSetterDecl(OutStream *os)
 
         mname.insert('_', 0);
 
-        if (member->isRef())
+        // by value and moved
+        if (member->isMovable())
+            line += member->getOutTypeName() + " " + mname;
+        else if (member->isRef())
             line += String("const ") + member->getOutTypeName() + " &" + mname;
         else
             line += member->getOutTypeName() + " " + mname;
@@ -295,12 +324,15 @@ void MemberLoop::writeSetterDecl(OutStream *os)
 
         mname.insert('_', 0);
 
-        line = String("        ") + m_arrayName + "[n]." + member->getName() + " = " + mname + ";";
+        if (member->isMovable())
+            line = String("        ") + m_arrayName + "[n]." + member->getName() + " = std::move(" + mname + ");";
+        else
+            line = String("        ") + m_arrayName + "[n]." + member->getName() + " = " + mname + ";";
         os->writeLine(line);
 
-        if (UInteger32::isInteger(member->getSizeOf()))
+        if (member->isFixedSize())
         {
-            intSize += UInteger32::parseInteger(member->getSizeOf());
+            intSize += member->getMinSize();
         }
         else
         {
@@ -324,7 +356,51 @@ void MemberLoop::writeSetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberLoop::writeSetterImpl(OutStream *os)
+void MemberLoop::writeSetterImpl(TextBuffer *os) const
 {
 
 }
+
+void MemberLoop::writeGetterDecl(TextBuffer *os) const
+{
+    String name = getName();
+    if (name.startsWith("m_"))
+        name.remove(0, 2);
+    if (name.length() >= 1)
+        name[0] = WideChar::toUpper(name[0]);
+
+    // the struct is declared with the private members, after the getters, so the
+    // return type is deduced (c++14)
+    os->writeLine(String("    const auto& get") + name + "s() const");
+    os->writeLine("    {");
+    os->writeLine("        return " + m_arrayName + ";");
+    os->writeLine("    }");
+    os->writeLine("");
+}
+
+void MemberLoop::writeBenchFill(TextBuffer *os, const String &obj) const
+{
+    // only for a root loop, with a root counter
+    if (isParent() || m_var->isParent())
+        return;
+
+    String values;
+    for (Member *member : m_members)
+    {
+        String value = member->getBenchValue();
+        if (value.isEmpty())
+            return;
+
+        values += ", " + value;
+    }
+
+    String type = m_var->getOutTypeName();
+
+    os->writeLine("    {");
+    os->writeLine("        " + type + " n = (" + type + ")rnd.nextCount();");
+    os->writeLine("        " + obj + ".set" + m_var->getAccessorName() + "(n);");
+    os->writeLine("        " + obj + ".alloc" + getAccessorName() + "s();");
+    os->writeLine("        for (" + type + " i = 0; i < n; ++i)");
+    os->writeLine("            " + obj + ".set" + getAccessorName() + "(i" + values + ");");
+    os->writeLine("    }");
+}
@@ -15,37 +15,46 @@
 namespace o3d {
 namespace dmg {
 
-class MemberLoop : public MemberHelper<MemberLoop, Member::TYPE_LOOP>
+class MemberLoop : public MemberHelper<MemberLoop, Member::TYPE_LOOP, BT_LOOP>
 {
 public:
 
     MemberLoop(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
     virtual T_StringList getHeaders() const;
 
-    virtual void writeDecl(OutStream *os);
+    virtual void writeDecl(TextBuffer *os) const;
 
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
+    virtual void writeReset(TextBuffer *os) const;
 
     virtual void setCond(Member *var, Member *varParam);
     virtual void addMember(Member *member);
     virtual Member* findMember(const String &name) const;
 
+    virtual void link();
+
+    //! Allocate the elements by DataArenaArray (arena = true).
+    void setArena(Bool arena) { m_arena = arena; }
+    Bool isArena() const { return m_arena; }
+
     //! Return the number of ident
     virtual UInt32 getIdent() const;
 
     //! Get the read/write children prefix
     virtual String getPrefix() const;
 
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
+
+    //! Getter of the elements, as many as the counter.
+    virtual void writeGetterDecl(TextBuffer *os) const;
+
+    virtual void writeBenchFill(TextBuffer *os, const String &obj) const;
+
+    virtual const std::list<Member*>* getChildren() const { return &m_members; }
 
 private:
 
@@ -53,6 +62,7 @@ private:
     Member *m_varParam;
 
     String m_arrayName;
+    Bool m_arena;
 
     std::list<Member*> m_members;
 };
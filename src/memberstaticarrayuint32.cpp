@@ -8,40 +8,17 @@
  */
 
 #include "memberstaticarrayuint32.h"
-#include "registermember.h"
 #include <o3d/core/integer.h>
 #include <o3d/core/char.h>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberStaticArrayUInt32>::R memberStaticArrayUInt32;
-
 MemberStaticArrayUInt32::MemberStaticArrayUInt32(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberStaticArrayUInt32::getTypeName() const
-{
-    return "uint32[]";
-}
-
-String MemberStaticArrayUInt32::getOutTypeName() const
-{
-    return "o3d::UInt32";
-}
-
-String MemberStaticArrayUInt32::getReadMethod() const
-{
-    return "read";
-}
-
-String MemberStaticArrayUInt32::getWriteMethod() const
-{
-    return "write";
-}
-
 T_StringList MemberStaticArrayUInt32::getHeaders() const
 {
     T_StringList list;
@@ -61,10 +38,10 @@ UInt32 MemberStaticArrayUInt32::getNewUIntId()
     return m_uintId.getID();
 }
 
-void MemberStaticArrayUInt32::writeDecl(OutStream *os)
+void MemberStaticArrayUInt32::writeDecl(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -81,7 +58,7 @@ void MemberStaticArrayUInt32::writeDecl(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberStaticArrayUInt32::writeSetterDecl(OutStream *os)
+void MemberStaticArrayUInt32::writeSetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -104,12 +81,12 @@ void MemberStaticArrayUInt32::writeSetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberStaticArrayUInt32::writeSetterImpl(OutStream *os)
+void MemberStaticArrayUInt32::writeSetterImpl(TextBuffer *os) const
 {
 
 }
 
-void MemberStaticArrayUInt32::writeGetterDecl(OutStream *os)
+void MemberStaticArrayUInt32::writeGetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -128,15 +105,15 @@ void MemberStaticArrayUInt32::writeGetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberStaticArrayUInt32::writeGetterImpl(OutStream *os)
+void MemberStaticArrayUInt32::writeGetterImpl(TextBuffer *os) const
 {
 
 }
 
-void MemberStaticArrayUInt32::writeRead(OutStream *os)
+void MemberStaticArrayUInt32::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -159,10 +136,10 @@ void MemberStaticArrayUInt32::writeRead(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberStaticArrayUInt32::writeWrite(OutStream *os)
+void MemberStaticArrayUInt32::writeWrite(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -185,14 +162,14 @@ void MemberStaticArrayUInt32::writeWrite(OutStream *os)
     os->writeLine(line);
 }
 
-Bool MemberStaticArrayUInt32::isRef() const
+UInt32 MemberStaticArrayUInt32::getMinSize() const
 {
-    return True;
+    return UInteger32::parseInteger(m_value);
 }
 
-UInt32 MemberStaticArrayUInt32::getMinSize() const
+Bool MemberStaticArrayUInt32::isFixedSize() const
 {
-    return UInteger32::parseInteger(m_value);
+    return True;
 }
 
 String MemberStaticArrayUInt32::getSizeOf() const
@@ -16,37 +16,31 @@
 namespace o3d {
 namespace dmg {
 
-class MemberStaticArrayUInt32 : public MemberHelper<MemberStaticArrayUInt32, Member::TYPE_UINT32_ARRAY>
+class MemberStaticArrayUInt32 : public MemberHelper<MemberStaticArrayUInt32, Member::TYPE_UINT32_ARRAY, BT_UINT32_ARRAY>
 {
 public:
 
     MemberStaticArrayUInt32(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
     virtual T_StringList getHeaders() const;
 
     virtual String getIfTest(const Member *param) const;
     virtual UInt32 getNewUIntId();
 
-    virtual void writeDecl(OutStream *os);
-
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeDecl(TextBuffer *os) const;
 
-    virtual void writeGetterDecl(OutStream *os);
-    virtual void writeGetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
+    virtual void writeGetterDecl(TextBuffer *os) const;
+    virtual void writeGetterImpl(TextBuffer *os) const;
 
-    virtual Bool isRef() const;
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
+    //! The size of the array, given by the value.
     virtual UInt32 getMinSize() const;
+    virtual Bool isFixedSize() const;
     virtual String getSizeOf() const;
 
 private:
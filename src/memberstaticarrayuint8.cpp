@@ -8,40 +8,17 @@
  */
 
 #include "memberstaticarrayuint8.h"
-#include "registermember.h"
 #include <o3d/core/integer.h>
 #include <o3d/core/char.h>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberStaticArrayUInt8>::R memberStaticArrayUInt8;
-
 MemberStaticArrayUInt8::MemberStaticArrayUInt8(Member *parent) :
     MemberHelper(parent)
 {
 }
 
-String MemberStaticArrayUInt8::getTypeName() const
-{
-    return "uint8[]";
-}
-
-String MemberStaticArrayUInt8::getOutTypeName() const
-{
-    return "o3d::UInt8";
-}
-
-String MemberStaticArrayUInt8::getReadMethod() const
-{
-    return "read";
-}
-
-String MemberStaticArrayUInt8::getWriteMethod() const
-{
-    return "write";
-}
-
 T_StringList MemberStaticArrayUInt8::getHeaders() const
 {
     T_StringList list;
@@ -61,10 +38,10 @@ UInt32 MemberStaticArrayUInt8::getNewUIntId()
     return m_uintId.getID();
 }
 
-void MemberStaticArrayUInt8::writeDecl(OutStream *os)
+void MemberStaticArrayUInt8::writeDecl(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -81,7 +58,7 @@ void MemberStaticArrayUInt8::writeDecl(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberStaticArrayUInt8::writeSetterDecl(OutStream *os)
+void MemberStaticArrayUInt8::writeSetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -105,12 +82,12 @@ void MemberStaticArrayUInt8::writeSetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberStaticArrayUInt8::writeSetterImpl(OutStream *os)
+void MemberStaticArrayUInt8::writeSetterImpl(TextBuffer *os) const
 {
 
 }
 
-void MemberStaticArrayUInt8::writeGetterDecl(OutStream *os)
+void MemberStaticArrayUInt8::writeGetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -129,15 +106,15 @@ void MemberStaticArrayUInt8::writeGetterDecl(OutStream *os)
     os->writeLine("");
 }
 
-void MemberStaticArrayUInt8::writeGetterImpl(OutStream *os)
+void MemberStaticArrayUInt8::writeGetterImpl(TextBuffer *os) const
 {
 
 }
 
-void MemberStaticArrayUInt8::writeRead(OutStream *os)
+void MemberStaticArrayUInt8::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -160,10 +137,10 @@ void MemberStaticArrayUInt8::writeRead(OutStream *os)
     os->writeLine(line);
 }
 
-void MemberStaticArrayUInt8::writeWrite(OutStream *os)
+void MemberStaticArrayUInt8::writeWrite(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -186,14 +163,14 @@ void MemberStaticArrayUInt8::writeWrite(OutStream *os)
     os->writeLine(line);
 }
 
-Bool MemberStaticArrayUInt8::isRef() const
+UInt32 MemberStaticArrayUInt8::getMinSize() const
 {
-    return True;
+    return UInteger32::parseInteger(m_value);
 }
 
-UInt32 MemberStaticArrayUInt8::getMinSize() const
+Bool MemberStaticArrayUInt8::isFixedSize() const
 {
-    return UInteger32::parseInteger(m_value);
+    return True;
 }
 
 String MemberStaticArrayUInt8::getSizeOf() const
@@ -8,48 +8,34 @@
  */
 
 #include "memberstring.h"
-#include "registermember.h"
 #include <o3d/core/file.h>
 
 using namespace o3d;
 using namespace o3d::dmg;
 
-RegisterMember<MemberString>::R memberString;
-
 MemberString::MemberString(Member *parent) :
-    MemberHelper(parent)
+    MemberHelper(parent),
+    m_interned(False)
 {
 }
 
-String MemberString::getTypeName() const
+const String& MemberString::getOutTypeName() const
 {
-    return "string";
-}
-
-String MemberString::getOutTypeName() const
-{
-    return "o3d::String";
-}
-
-String MemberString::getReadMethod() const
-{
-    return "readFromFile";
-}
-
-String MemberString::getWriteMethod() const
-{
-    return "writeToFile";
+    // shares the string of the table, no copy by read
+    static const String sharedString("DataSharedString");
+    return m_interned ? sharedString : Member::getOutTypeName();
 }
 
 T_StringList MemberString::getHeaders() const
 {
     T_StringList list;
     list.push_back("<o3d/core/String.h>");
+    list.push_back("<utility>");
 
     return list;
 }
 
-void MemberString::writeSetterDecl(OutStream *os)
+void MemberString::writeSetterDecl(TextBuffer *os) const
 {
     String line("    ");
 
@@ -70,12 +56,19 @@ void MemberString::writeSetterDecl(OutStream *os)
     os->writeLine(line);
     os->writeLine("    }");
     os->writeLine("");
+
+    // a copy if o3d::String has no move assignment
+    os->writeLine("    void set" + name + "(" + getOutTypeName() + " &&" + mname + ")");
+    os->writeLine("    {");
+    os->writeLine("        " + getName() + " = std::move(" + mname + ");");
+    os->writeLine("    }");
+    os->writeLine("");
 }
 
-void MemberString::writeRead(OutStream *os)
+void MemberString::writeRead(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -88,15 +81,20 @@ void MemberString::writeRead(OutStream *os)
         line += "    ";
     }
 
-    line += (isParent() ? getParent()->getPrefix() : "") + getName() + ".readFromFile(is);";
+    String prefixedName = (isParent() ? getParent()->getPrefix() : "") + getName();
+
+    if (m_interned)
+        line += "readString(is, strings, " + prefixedName + ");";
+    else
+        line += prefixedName + ".readFromFile(is);";
 
     os->writeLine(line);
 }
 
-void MemberString::writeWrite(OutStream *os)
+void MemberString::writeWrite(TextBuffer *os) const
 {
     Int32 ident = 1;
-    Member *parent = getParent();
+    const Member *parent = getParent();
     while (parent != nullptr)
     {
         ident += parent->getIdent();
@@ -111,27 +109,62 @@ void MemberString::writeWrite(OutStream *os)
 
     String prefixedName = (isParent() ? getParent()->getPrefix() : "") + getName();
 
-    line += (isParent() ? getParent()->getPrefix() : "") + getName() + ".writeToFile(os);";
+    if (m_interned)
+        line += "writeString(os, strings, " + prefixedName + ");";
+    else
+        line += prefixedName + ".writeToFile(os);";
 
     os->writeLine(line);
 }
 
-void MemberString::writeSetterImpl(OutStream *os)
+Member::Column MemberString::getColumn() const
 {
+    return COLUMN_STREAM;
+}
 
+void MemberString::writeColumnRead(TextBuffer *os) const
+{
+    os->writeLine("    // " + getName());
+    os->writeLine("    for (o3d::UInt32 i = 0; i < count; ++i)");
+    os->writeLine("    {");
+    // a batch has no string table
+    os->writeLine("        records[i]." + getName() + ".readFromFile(is);");
+    os->writeLine("    }");
+    os->writeLine("");
 }
 
-Bool MemberString::isRef() const
+void MemberString::writeColumnWrite(TextBuffer *os) const
 {
-    return True;
+    os->writeLine("    // " + getName());
+    os->writeLine("    for (o3d::UInt32 i = 0; i < count; ++i)");
+    os->writeLine("    {");
+    // a batch has no string table
+    os->writeLine("        records[i]." + getName() + ".writeToFile(os);");
+    os->writeLine("    }");
+    os->writeLine("");
 }
 
-UInt32 MemberString::getMinSize() const
+void MemberString::writeSetterImpl(TextBuffer *os) const
 {
-    return 2;
+
+}
+
+void MemberString::writeReset(TextBuffer *os) const
+{
+    // releases the string, shared with the table or another record
+    if (m_interned)
+        os->writeLine("    " + getPrefixedName() + ".clear();");
+    else
+        Member::writeReset(os);
 }
 
 String MemberString::getSizeOf() const
 {
     return getName() + ".length() + 2";
 }
+
+UInt32 MemberString::getMinSize() const
+{
+    // the index into the string table
+    return m_interned ? 1 : Member::getMinSize();
+}
@@ -15,32 +15,43 @@
 namespace o3d {
 namespace dmg {
 
-class MemberString : public MemberHelper<MemberString, Member::TYPE_STRING>
+class MemberString : public MemberHelper<MemberString, Member::TYPE_STRING, BT_STRING>
 {
 public:
 
     MemberString(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
+    //! DataSharedString if interned.
+    virtual const String& getOutTypeName() const;
 
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
+    virtual void writeRead(TextBuffer *os) const;
+    virtual void writeWrite(TextBuffer *os) const;
 
-    virtual void writeRead(OutStream *os);
-    virtual void writeWrite(OutStream *os);
+    virtual Column getColumn() const;
+    virtual void writeColumnRead(TextBuffer *os) const;
+    virtual void writeColumnWrite(TextBuffer *os) const;
 
     virtual T_StringList getHeaders() const;
 
-    virtual void writeSetterDecl(OutStream *os);
-    virtual void writeSetterImpl(OutStream *os);
+    virtual void writeSetterDecl(TextBuffer *os) const;
+    virtual void writeSetterImpl(TextBuffer *os) const;
 
-    virtual Bool isRef() const;
+    virtual void writeReset(TextBuffer *os) const;
 
-    virtual UInt32 getMinSize() const;
     virtual String getSizeOf() const;
+    virtual UInt32 getMinSize() const;
+
+    //! Write the string as an index into the string table of the stream, if it has
+    //! one (pack.strings = true).
+    void setInterned(Bool interned) { m_interned = interned; }
+    Bool isInterned() const { return m_interned; }
+
+    //! True if interned, by the DataEncoding functions.
+    virtual Bool isEncoded() const { return m_interned; }
 
 private:
+
+    Bool m_interned;
 };
 
 } // namespace dmg
@@ -0,0 +1,29 @@
+/**
+ * @file memberstringview.cpp
+ * @brief UTF-8 string member read as a view into the buffer of the stream.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#include "memberstringview.h"
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+MemberStringView::MemberStringView(Member *parent) :
+    MemberHelper(parent)
+{
+}
+
+void MemberStringView::writeGetterDecl(TextBuffer *os) const
+{
+    Member::writeGetterDecl(os);
+
+    os->writeLine("    o3d::String get" + getAccessorName() + "String() const");
+    os->writeLine("    {");
+    os->writeLine("        return " + getName() + ".toString();");
+    os->writeLine("    }");
+    os->writeLine("");
+}
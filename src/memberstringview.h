@@ -0,0 +1,38 @@
+/**
+ * @file memberstringview.h
+ * @brief UTF-8 string member read as a view into the buffer of the stream.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#ifndef _O3D_DMG_MEMBERSTRINGVIEW_H
+#define _O3D_DMG_MEMBERSTRINGVIEW_H
+
+#include "member.h"
+
+namespace o3d {
+namespace dmg {
+
+/**
+ * @brief A DataStringView (DataEncoding header), a pointer and a length into the
+ * buffer of the input stream, so reading it allocates nothing. The buffer must
+ * outlive the record.
+ */
+class MemberStringView : public MemberHelper<MemberStringView, Member::TYPE_STRINGVIEW, BT_STRINGVIEW>
+{
+public:
+
+    MemberStringView(Member *parent);
+
+    //! The view getter, and a getter of an owning copy (o3d::String).
+    virtual void writeGetterDecl(TextBuffer *os) const;
+
+private:
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_MEMBERSTRINGVIEW_H
@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberUInt16 : public MemberHelper<MemberUInt16, Member::TYPE_UINT16>
+class MemberUInt16 : public MemberHelper<MemberUInt16, Member::TYPE_UINT16, BT_UINT16>
 {
 public:
 
     MemberUInt16(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberUInt32 : public MemberHelper<MemberUInt32, Member::TYPE_UINT32>
+class MemberUInt32 : public MemberHelper<MemberUInt32, Member::TYPE_UINT32, BT_UINT32>
 {
 public:
 
     MemberUInt32(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberUInt64 : public MemberHelper<MemberUInt64, Member::TYPE_UINT64>
+class MemberUInt64 : public MemberHelper<MemberUInt64, Member::TYPE_UINT64, BT_UINT64>
 {
 public:
 
     MemberUInt64(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
@@ -15,21 +15,12 @@
 namespace o3d {
 namespace dmg {
 
-class MemberUInt8 : public MemberHelper<MemberUInt8, Member::TYPE_UINT8>
+class MemberUInt8 : public MemberHelper<MemberUInt8, Member::TYPE_UINT8, BT_UINT8>
 {
 public:
 
     MemberUInt8(Member *parent);
 
-    virtual String getTypeName() const;
-    virtual String getOutTypeName() const;
-
-    virtual String getReadMethod() const;
-    virtual String getWriteMethod() const;
-
-    virtual UInt32 getMinSize() const;
-    virtual String getSizeOf() const;
-
 private:
 };
 
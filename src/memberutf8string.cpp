@@ -0,0 +1,53 @@
+/**
+ * @file memberutf8string.cpp
+ * @brief String member stored as UTF-8 bytes (std::string), without transcoding.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#include "memberutf8string.h"
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+MemberUtf8String::MemberUtf8String(Member *parent) :
+    MemberHelper(parent)
+{
+}
+
+T_StringList MemberUtf8String::getHeaders() const
+{
+    T_StringList list;
+    list.push_back("<string>");
+    list.push_back("<utility>");
+
+    return list;
+}
+
+void MemberUtf8String::writeRead(TextBuffer *os) const
+{
+    Int32 ident = 1;
+    const Member *parent = getParent();
+    while (parent != nullptr)
+    {
+        ident += parent->getIdent();
+        parent = parent->getParent();
+    }
+
+    String line;
+    for (Int32 i = 0; i < ident; ++i)
+    {
+        line += "    ";
+    }
+
+    line += "readUtf8String(is, " + getPrefixedName() + ");";
+    os->writeLine(line);
+}
+
+String MemberUtf8String::getSizeOf() const
+{
+    // the length prefix is 1 to 5 bytes
+    return getName() + ".size() + 1";
+}
@@ -0,0 +1,37 @@
+/**
+ * @file memberutf8string.h
+ * @brief String member stored as UTF-8 bytes (std::string), without transcoding.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#ifndef _O3D_DMG_MEMBERUTF8STRING_H
+#define _O3D_DMG_MEMBERUTF8STRING_H
+
+#include "member.h"
+
+namespace o3d {
+namespace dmg {
+
+class MemberUtf8String : public MemberHelper<MemberUtf8String, Member::TYPE_UTF8STRING, BT_UTF8STRING>
+{
+public:
+
+    MemberUtf8String(Member *parent);
+
+    virtual T_StringList getHeaders() const;
+
+    //! Read into the string, keeping its capacity.
+    virtual void writeRead(TextBuffer *os) const;
+
+    virtual String getSizeOf() const;
+
+private:
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_MEMBERUTF8STRING_H
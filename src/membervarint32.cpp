@@ -0,0 +1,18 @@
+/**
+ * @file membervarint32.cpp
+ * @brief Signed 32 bits integer member, zigzag and LEB128 encoded.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#include "membervarint32.h"
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+MemberVarInt32::MemberVarInt32(Member *parent) :
+    MemberHelper(parent)
+{
+}
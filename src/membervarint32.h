@@ -0,0 +1,30 @@
+/**
+ * @file membervarint32.h
+ * @brief Signed 32 bits integer member, zigzag and LEB128 encoded.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#ifndef _O3D_DMG_MEMBERVARINT32_H
+#define _O3D_DMG_MEMBERVARINT32_H
+
+#include "member.h"
+
+namespace o3d {
+namespace dmg {
+
+class MemberVarInt32 : public MemberHelper<MemberVarInt32, Member::TYPE_VARINT32, BT_VARINT32>
+{
+public:
+
+    MemberVarInt32(Member *parent);
+
+private:
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_MEMBERVARINT32_H
@@ -0,0 +1,18 @@
+/**
+ * @file membervarint64.cpp
+ * @brief Signed 64 bits integer member, zigzag and LEB128 encoded.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#include "membervarint64.h"
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+MemberVarInt64::MemberVarInt64(Member *parent) :
+    MemberHelper(parent)
+{
+}
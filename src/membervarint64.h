@@ -0,0 +1,30 @@
+/**
+ * @file membervarint64.h
+ * @brief Signed 64 bits integer member, zigzag and LEB128 encoded.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#ifndef _O3D_DMG_MEMBERVARINT64_H
+#define _O3D_DMG_MEMBERVARINT64_H
+
+#include "member.h"
+
+namespace o3d {
+namespace dmg {
+
+class MemberVarInt64 : public MemberHelper<MemberVarInt64, Member::TYPE_VARINT64, BT_VARINT64>
+{
+public:
+
+    MemberVarInt64(Member *parent);
+
+private:
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_MEMBERVARINT64_H
@@ -0,0 +1,18 @@
+/**
+ * @file membervaruint32.cpp
+ * @brief Unsigned 32 bits integer member, LEB128 encoded.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#include "membervaruint32.h"
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+MemberVarUInt32::MemberVarUInt32(Member *parent) :
+    MemberHelper(parent)
+{
+}
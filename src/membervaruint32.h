@@ -0,0 +1,30 @@
+/**
+ * @file membervaruint32.h
+ * @brief Unsigned 32 bits integer member, LEB128 encoded.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#ifndef _O3D_DMG_MEMBERVARUINT32_H
+#define _O3D_DMG_MEMBERVARUINT32_H
+
+#include "member.h"
+
+namespace o3d {
+namespace dmg {
+
+class MemberVarUInt32 : public MemberHelper<MemberVarUInt32, Member::TYPE_VARUINT32, BT_VARUINT32>
+{
+public:
+
+    MemberVarUInt32(Member *parent);
+
+private:
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_MEMBERVARUINT32_H
@@ -0,0 +1,18 @@
+/**
+ * @file membervaruint64.cpp
+ * @brief Unsigned 64 bits integer member, LEB128 encoded.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#include "membervaruint64.h"
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+MemberVarUInt64::MemberVarUInt64(Member *parent) :
+    MemberHelper(parent)
+{
+}
@@ -0,0 +1,30 @@
+/**
+ * @file membervaruint64.h
+ * @brief Unsigned 64 bits integer member, LEB128 encoded.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details 
+ */
+
+#ifndef _O3D_DMG_MEMBERVARUINT64_H
+#define _O3D_DMG_MEMBERVARUINT64_H
+
+#include "member.h"
+
+namespace o3d {
+namespace dmg {
+
+class MemberVarUInt64 : public MemberHelper<MemberVarUInt64, Member::TYPE_VARUINT64, BT_VARUINT64>
+{
+public:
+
+    MemberVarUInt64(Member *parent);
+
+private:
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_MEMBERVARUINT64_H
@@ -0,0 +1,137 @@
+/**
+ * @file provider.cpp
+ * @brief Sources input and generated files output of a Generator.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "provider.h"
+
+#include <o3d/core/debug.h>
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+SourceProvider::~SourceProvider()
+{
+}
+
+OutputSink::~OutputSink()
+{
+}
+
+Bool OutputSink::isSame(const String &filename, const TextBuffer &content)
+{
+    return False;
+}
+
+void MemorySourceProvider::add(const String &filename, const T_StringList &lines)
+{
+    m_sources[filename] = lines;
+}
+
+void MemorySourceProvider::add(const String &filename, const String &content)
+{
+    T_StringList &lines = m_sources[filename];
+    lines.clear();
+
+    Int32 begin = 0, end;
+    while ((end = content.find('\n', begin)) != -1)
+    {
+        lines.push_back(content.sub(begin, end));
+        begin = end + 1;
+    }
+
+    if (begin < (Int32)content.length())
+        lines.push_back(content.sub(begin, -1));
+}
+
+void MemorySourceProvider::read(const String &filename, T_StringList &lines)
+{
+    auto it = m_sources.find(filename);
+    if (it == m_sources.end())
+        O3D_ERROR(E_InvalidParameter("Unknown source " + filename));
+
+    lines = it->second;
+}
+
+void MemorySourceProvider::list(const String &path, const T_StringList &exts, T_StringList &names)
+{
+    String prefix = path + "/";
+
+    for (const auto &entry : m_sources)
+    {
+        if (!entry.first.startsWith(prefix))
+            continue;
+
+        String name = entry.first.sub(prefix.length(), -1);
+
+        // hidden folders are ignored, like for the files system
+        if (name.startsWith(".") || name.sub("/.", 0) != -1)
+            continue;
+
+        for (const String &ext : exts)
+        {
+            if (name.endsWith("." + ext))
+            {
+                names.push_back(name);
+                break;
+            }
+        }
+    }
+}
+
+void MemoryOutputSink::add(const String &filename, const TextBuffer &content)
+{
+    m_files[filename] = content;
+}
+
+Bool MemoryOutputSink::exists(const String &filename)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_files.find(filename) != m_files.end();
+}
+
+void MemoryOutputSink::write(const String &filename, TextBuffer content)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_files[filename] = std::move(content);
+}
+
+Bool MemoryOutputSink::isSame(const String &filename, const TextBuffer &content)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_files.find(filename);
+    return it != m_files.end() && it->second.getLines() == content.getLines();
+}
+
+void MemoryOutputSink::read(const String &filename, T_StringList &lines)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_files.find(filename);
+    if (it == m_files.end())
+        O3D_ERROR(E_InvalidParameter("Unknown output " + filename));
+
+    lines = it->second.getLines();
+}
+
+String MemoryOutputSink::getContent(const String &filename) const
+{
+    String result;
+
+    auto it = m_files.find(filename);
+    if (it == m_files.end())
+        return result;
+
+    for (const String &line : it->second.getLines())
+    {
+        result += line;
+        result += '\n';
+    }
+
+    return result;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file provider.h
+ * @brief Sources input and generated files output of a Generator.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _O3D_DMG_PROVIDER_H
+#define _O3D_DMG_PROVIDER_H
+
+#include <o3d/core/stringmap.h>
+#include "textbuffer.h"
+
+#include <mutex>
+
+namespace o3d {
+namespace dmg {
+
+/**
+ * @brief Give the content of the .dmg and .tdg sources, and of the templates.
+ * Names are built by the generator from the input and templates paths of its
+ * config, with '/' as separator, for example "src/pkg/Model.dmg".
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class SourceProvider
+{
+public:
+
+    virtual ~SourceProvider();
+
+    //! Read the lines of a source. Throw an E_InvalidParameter if not found.
+    virtual void read(const String &filename, T_StringList &lines) = 0;
+
+    /**
+     * @brief List the sources with one of the extensions found under a path,
+     * recursively, skipping the folders starting with a dot.
+     * @param path Input path.
+     * @param exts Extensions, without the dot.
+     * @param names Returned names, relative to path.
+     */
+    virtual void list(const String &path, const T_StringList &exts, T_StringList &names) = 0;
+};
+
+/**
+ * @brief Receive the generated files.
+ * Names are built from the output paths of the config.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class OutputSink
+{
+public:
+
+    virtual ~OutputSink();
+
+    //! Check for an existing output (user implementation files are never overwritten).
+    virtual Bool exists(const String &filename) = 0;
+
+    //! Store a generated file, creating its folder as necessary. The content is given
+    //! (moved by the callers done with it). Called concurrently by the render of the profiles.
+    virtual void write(const String &filename, TextBuffer content) = 0;
+
+    //! True if the output exists with the same content, so it is not necessary to
+    //! write it again (default always false).
+    virtual Bool isSame(const String &filename, const TextBuffer &content);
+
+    //! Read back the lines of an output, like the shard manifests written before.
+    //! Throw an E_InvalidParameter if not found.
+    virtual void read(const String &filename, T_StringList &lines) = 0;
+};
+
+/**
+ * @brief Sources given as buffers.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class MemorySourceProvider : public SourceProvider
+{
+public:
+
+    //! Add or replace a source.
+    void add(const String &filename, const T_StringList &lines);
+
+    //! Add or replace a source given as a single text, split on '\n'.
+    void add(const String &filename, const String &content);
+
+    virtual void read(const String &filename, T_StringList &lines) override;
+    virtual void list(const String &path, const T_StringList &exts, T_StringList &names) override;
+
+private:
+
+    StringMap<T_StringList> m_sources;
+};
+
+/**
+ * @brief Generated files returned as buffers.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class MemoryOutputSink : public OutputSink
+{
+public:
+
+    //! Add an existing output, to simulate a previously generated user file.
+    void add(const String &filename, const TextBuffer &content);
+
+    virtual Bool exists(const String &filename) override;
+    virtual void write(const String &filename, TextBuffer content) override;
+    virtual Bool isSame(const String &filename, const TextBuffer &content) override;
+    virtual void read(const String &filename, T_StringList &lines) override;
+
+    //! Generated files, by name.
+    const StringMap<TextBuffer>& getFiles() const { return m_files; }
+
+    //! Content of a generated file, joined with '\n'. Empty if not found.
+    String getContent(const String &filename) const;
+
+private:
+
+    std::mutex m_mutex;
+    StringMap<TextBuffer> m_files;
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_PROVIDER_H
@@ -0,0 +1,123 @@
+/**
+ * @file renderpool.cpp
+ * @brief Threads running the render tasks of the parsed files.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "renderpool.h"
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+RenderPool::RenderPool(UInt32 numThreads) :
+    m_running(0),
+    m_stop(False)
+{
+    for (UInt32 i = 0; i < numThreads; ++i)
+    {
+        m_threads.push_back(std::thread(&RenderPool::run, this));
+    }
+}
+
+RenderPool::~RenderPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stop = True;
+        m_tasks.clear();
+    }
+
+    m_wakeUp.notify_all();
+
+    for (std::thread &thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void RenderPool::post(const Task &task)
+{
+    if (m_threads.empty())
+    {
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(task);
+    }
+
+    m_wakeUp.notify_one();
+}
+
+void RenderPool::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this] () { return m_tasks.empty() && m_running == 0; });
+
+    if (m_error)
+    {
+        std::exception_ptr error = m_error;
+        m_error = nullptr;
+
+        std::rethrow_exception(error);
+    }
+}
+
+Bool RenderPool::hasFailed()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_error != nullptr;
+}
+
+void RenderPool::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;)
+    {
+        m_wakeUp.wait(lock, [this] () { return m_stop || !m_tasks.empty(); });
+
+        if (m_stop)
+            break;
+
+        Task task = m_tasks.front();
+        m_tasks.pop_front();
+
+        // drop the tasks after a failure
+        if (m_error)
+        {
+            if (m_tasks.empty() && m_running == 0)
+                m_idle.notify_all();
+
+            continue;
+        }
+
+        ++m_running;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            task();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        // release the captures before locking
+        task = nullptr;
+
+        lock.lock();
+        --m_running;
+
+        if (error && !m_error)
+            m_error = error;
+
+        if (m_tasks.empty() && m_running == 0)
+            m_idle.notify_all();
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * @file renderpool.h
+ * @brief Threads running the render tasks of the parsed files.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _O3D_DMG_RENDERPOOL_H
+#define _O3D_DMG_RENDERPOOL_H
+
+#include <o3d/core/architecture.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace o3d {
+namespace dmg {
+
+/**
+ * @brief Run the posted tasks on a fixed number of threads, in order of post.
+ * After a failed task the next ones are dropped, and the error is rethrown by wait().
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class RenderPool
+{
+public:
+
+    typedef std::function<void()> Task;
+
+    //! Start numThreads threads. Without thread, the tasks are run by post().
+    RenderPool(UInt32 numThreads);
+
+    //! Drop the tasks not started and join the threads.
+    ~RenderPool();
+
+    void post(const Task &task);
+
+    //! Wait for the posted tasks. Rethrow the first error of a task.
+    void wait();
+
+    //! True if a task failed.
+    Bool hasFailed();
+
+private:
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;   //!< task posted, or stop
+    std::condition_variable m_idle;     //!< no more task
+
+    std::deque<Task> m_tasks;
+    UInt32 m_running;
+
+    Bool m_stop;
+    std::exception_ptr m_error;
+
+    std::vector<std::thread> m_threads;
+
+    void run();
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_RENDERPOOL_H
@@ -0,0 +1,360 @@
+/**
+ * @file stats.cpp
+ * @brief Per file phase timing and chrome trace events.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "stats.h"
+#include "provider.h"
+
+#include <o3d/core/debug.h>
+
+#include <chrono>
+
+#ifdef DMG_COUNT_ALLOCS
+#include <cstdlib>
+#include <new>
+
+// per thread, so a scope only counts the allocations of its own thread (the profiles
+// are rendered concurrently)
+static thread_local o3d::UInt64 gAllocCount = 0;
+
+void* operator new(std::size_t size)
+{
+    ++gAllocCount;
+
+    void *ptr = std::malloc(size ? size : 1);
+    if (!ptr)
+        throw std::bad_alloc();
+
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+#endif
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+static const char* phaseNames[Stats::NUM_PHASES] = {
+    "load",
+    "pass0",
+    "pass1",
+    "import",
+    "process",
+    "displayer",
+    "authority",
+    "editor",
+    "write"
+};
+
+//! Taken as soon as possible, to measure the startup.
+static const UInt64 gProcessBegin = Stats::now();
+
+static String msStr(UInt64 ns)
+{
+    return String::print("%.3f", Double(ns) / 1000000.0);
+}
+
+static String jsonEscape(const String &str)
+{
+    String result;
+    for (UInt32 i = 0; i < str.length(); ++i)
+    {
+        // the control characters are not allowed into a JSON string
+        if ((UInt32)str[i] < 0x20)
+        {
+            result += String::print("\\u%04x", (UInt32)str[i]);
+            continue;
+        }
+
+        if (str[i] == '"' || str[i] == '\\')
+            result += '\\';
+
+        result += str[i];
+    }
+
+    return result;
+}
+
+Stats::FileStats::FileStats() :
+    bytesRead(0),
+    bytesWritten(0),
+    filesWritten(0),
+    filesSkipped(0)
+{
+    for (UInt32 i = 0; i < NUM_PHASES; ++i)
+    {
+        time[i] = 0;
+        allocs[i] = 0;
+    }
+}
+
+Stats::Stats() :
+    m_enabled(False),
+    m_origin(gProcessBegin),
+    m_startup(0)
+{
+}
+
+UInt64 Stats::now()
+{
+    return (UInt64)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+UInt64 Stats::getAllocCount()
+{
+#ifdef DMG_COUNT_ALLOCS
+    return gAllocCount;
+#else
+    return 0;
+#endif
+}
+
+UInt64 Stats::getProcessBegin()
+{
+    return gProcessBegin;
+}
+
+void Stats::markStartup()
+{
+    UInt64 end = now();
+
+    {
+        // generate may run concurrently, only the first call counts
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_startup != 0)
+            return;
+
+        m_startup = end - gProcessBegin;
+    }
+
+    addTraceEvent("startup", "", gProcessBegin, end);
+}
+
+UInt64 Stats::getStartupTime() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_startup;
+}
+
+void Stats::addTime(const String &filename, Stats::Phase phase, UInt64 ns, UInt64 allocs)
+{
+    if (!m_enabled || phase >= NUM_PHASES)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    FileStats &fs = m_files[filename];
+    fs.time[phase] += ns;
+    fs.allocs[phase] += allocs;
+}
+
+void Stats::addBytesRead(const String &filename, UInt64 bytes)
+{
+    if (!m_enabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_files[filename].bytesRead += bytes;
+}
+
+void Stats::addBytesWritten(const String &filename, UInt64 bytes)
+{
+    if (!m_enabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    FileStats &fs = m_files[filename];
+    fs.bytesWritten += bytes;
+    ++fs.filesWritten;
+}
+
+void Stats::addFileSkipped(const String &filename)
+{
+    if (!m_enabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    ++m_files[filename].filesSkipped;
+}
+
+void Stats::addTraceEvent(const char *name, const String &filename, UInt64 begin, UInt64 end)
+{
+    if (m_traceFile.isEmpty())
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_events.push_back(TraceEvent());
+    TraceEvent &evt = m_events.back();
+
+    evt.name = name;
+    evt.filename = filename;
+    evt.begin = begin;
+    evt.end = end;
+
+    auto it = m_threads.find(std::this_thread::get_id());
+    if (it == m_threads.end())
+        it = m_threads.insert(std::make_pair(std::this_thread::get_id(), (UInt32)m_threads.size() + 1)).first;
+
+    evt.tid = it->second;
+}
+
+void Stats::print() const
+{
+    if (!m_enabled)
+        return;
+
+    FileStats total;
+
+    String header;
+    for (UInt32 i = 0; i < NUM_PHASES; ++i)
+    {
+        header += String(phaseNames[i]) + " ";
+    }
+    header += "allocs read written files skipped";
+
+    System::print(header, "Stats (ms, render includes write)");
+
+    for (std::pair<String, FileStats> entry : m_files)
+    {
+        const FileStats &fs = entry.second;
+
+        String line;
+        for (UInt32 i = 0; i < NUM_PHASES; ++i)
+        {
+            line += msStr(fs.time[i]) + " ";
+            total.time[i] += fs.time[i];
+            total.allocs[i] += fs.allocs[i];
+        }
+
+#ifdef DMG_COUNT_ALLOCS
+        // load, passes, process (link) and renders are the top level phases, others are
+        // nested into, excepted the writes of the writer thread (<output>)
+        UInt64 allocs = fs.allocs[PHASE_LOAD] + fs.allocs[PHASE_PASS0] +
+                fs.allocs[PHASE_PASS1] + fs.allocs[PHASE_PROCESS] +
+                fs.allocs[PHASE_RENDER_DISPLAYER] + fs.allocs[PHASE_RENDER_AUTHORITY] +
+                fs.allocs[PHASE_RENDER_EDITOR];
+
+        line += String::print("%llu ", (unsigned long long)allocs);
+#else
+        line += "n/a ";
+#endif
+
+        line += String::print("%llu %llu %u %u",
+                              (unsigned long long)fs.bytesRead,
+                              (unsigned long long)fs.bytesWritten,
+                              fs.filesWritten,
+                              fs.filesSkipped);
+
+        total.bytesRead += fs.bytesRead;
+        total.bytesWritten += fs.bytesWritten;
+        total.filesWritten += fs.filesWritten;
+        total.filesSkipped += fs.filesSkipped;
+
+        System::print(line, entry.first);
+    }
+
+    String line;
+    for (UInt32 i = 0; i < NUM_PHASES; ++i)
+    {
+        line += msStr(total.time[i]) + " ";
+    }
+
+#ifdef DMG_COUNT_ALLOCS
+    UInt64 allocs = total.allocs[PHASE_LOAD] + total.allocs[PHASE_PASS0] +
+            total.allocs[PHASE_PASS1] + total.allocs[PHASE_PROCESS] +
+            total.allocs[PHASE_RENDER_DISPLAYER] + total.allocs[PHASE_RENDER_AUTHORITY] +
+            total.allocs[PHASE_RENDER_EDITOR];
+
+    line += String::print("%llu ", (unsigned long long)allocs);
+#else
+    line += "n/a ";
+#endif
+
+    line += String::print("%llu %llu %u %u",
+                          (unsigned long long)total.bytesRead,
+                          (unsigned long long)total.bytesWritten,
+                          total.filesWritten,
+                          total.filesSkipped);
+
+    System::print(line, "Total");
+
+    System::print(msStr(m_startup), "Startup (ms, until the first parse)");
+}
+
+void Stats::writeTrace(OutputSink &output) const
+{
+    if (m_traceFile.isEmpty())
+        return;
+
+    TextBuffer buffer;
+    buffer.writeLine("{\"traceEvents\":[");
+
+    size_t n = 0;
+    for (const TraceEvent &evt : m_events)
+    {
+        String line = String("{\"name\":\"") + evt.name + "\",\"cat\":\"dmg\",\"ph\":\"X\"," +
+                String::print("\"ts\":%.3f,\"dur\":%.3f,",
+                              Double(evt.begin - m_origin) / 1000.0,
+                              Double(evt.end - evt.begin) / 1000.0) +
+                String::print("\"pid\":1,\"tid\":%u,", evt.tid) + "\"args\":{\"file\":\"" + jsonEscape(evt.filename) + "\"}}";
+
+        if (++n < m_events.size())
+            line += ",";
+
+        buffer.writeLine(line);
+    }
+
+    buffer.writeLine("],\"displayTimeUnit\":\"ms\"}");
+
+    output.write(m_traceFile, std::move(buffer));
+}
+
+StatsScope::StatsScope(Stats &stats, const char *name, const String &filename, Stats::Phase phase) :
+    m_stats(stats),
+    m_name(name),
+    m_phase(phase),
+    m_begin(0),
+    m_allocs(0)
+{
+    if (m_stats.isActive())
+    {
+        m_filename = filename;
+        m_allocs = Stats::getAllocCount();
+        m_begin = Stats::now();
+    }
+}
+
+StatsScope::~StatsScope()
+{
+    if (m_stats.isActive())
+    {
+        UInt64 end = Stats::now();
+
+        m_stats.addTime(m_filename, m_phase, end - m_begin, Stats::getAllocCount() - m_allocs);
+        m_stats.addTraceEvent(m_name, m_filename, m_begin, end);
+    }
+}
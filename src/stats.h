@@ -0,0 +1,162 @@
+/**
+ * @file stats.h
+ * @brief Per file phase timing and chrome trace events.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _O3D_DMG_STATS_H
+#define _O3D_DMG_STATS_H
+
+#include <o3d/core/string.h>
+#include <o3d/core/stringmap.h>
+
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace o3d {
+namespace dmg {
+
+class OutputSink;
+
+/**
+ * @brief Collect wall time per phase and per file, I/O volumes, and trace events.
+ * Everything is a no-op until setEnabled() or setTraceFile() is called, so the
+ * instrumented code path costs a single test when the --stats and --trace
+ * options are not given. The add methods can be called from the render threads.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class Stats
+{
+public:
+
+    enum Phase
+    {
+        PHASE_LOAD = 0,          //!< config and templates loading
+        PHASE_PASS0,             //!< first pass (imports and objects names)
+        PHASE_PASS1,             //!< second pass (objects content)
+        PHASE_IMPORT,            //!< imported files (included into the passes)
+        PHASE_PROCESS,           //!< whole process step
+        PHASE_RENDER_DISPLAYER,  //!< displayer profile generation
+        PHASE_RENDER_AUTHORITY,  //!< authority profile generation
+        PHASE_RENDER_EDITOR,     //!< editor profile generation
+        PHASE_WRITE,             //!< directories and files creation
+        PHASE_LAST = PHASE_WRITE,
+        PHASE_NONE               //!< trace event only
+    };
+
+    static const UInt32 NUM_PHASES = PHASE_LAST + 1;
+
+    struct FileStats
+    {
+        FileStats();
+
+        UInt64 time[NUM_PHASES];     //!< in nanoseconds
+        UInt64 allocs[NUM_PHASES];   //!< number of allocations
+
+        UInt64 bytesRead;
+        UInt64 bytesWritten;
+
+        UInt32 filesWritten;
+        UInt32 filesSkipped;
+    };
+
+    Stats();
+
+    void setEnabled(Bool enabled) { m_enabled = enabled; }
+    Bool isEnabled() const { return m_enabled; }
+
+    void setTraceFile(const String &filename) { m_traceFile = filename; }
+    Bool isTracing() const { return m_traceFile.isValid(); }
+
+    //! True if statistics or trace are collected.
+    Bool isActive() const { return m_enabled || m_traceFile.isValid(); }
+
+    //! Monotonic time in nanoseconds.
+    static UInt64 now();
+
+    //! Number of allocations done by the calling thread since its start (0 if not
+    //! compiled with DMG_COUNT_ALLOCS).
+    static UInt64 getAllocCount();
+
+    //! Time of the static initialization, just after exec and the dynamic linking.
+    static UInt64 getProcessBegin();
+
+    //! Mark the end of the startup, at the first parse (only the first call counts).
+    void markStartup();
+
+    //! Time from the process begin to the first parse in nanoseconds (0 if not reached).
+    UInt64 getStartupTime() const;
+
+    void addTime(const String &filename, Phase phase, UInt64 ns, UInt64 allocs);
+    void addBytesRead(const String &filename, UInt64 bytes);
+    void addBytesWritten(const String &filename, UInt64 bytes);
+    void addFileSkipped(const String &filename);
+
+    void addTraceEvent(const char *name, const String &filename, UInt64 begin, UInt64 end);
+
+    //! Print the per file table and the totals.
+    void print() const;
+
+    //! Write the trace events in the chrome trace event format (JSON) to output.
+    void writeTrace(OutputSink &output) const;
+
+private:
+
+    struct TraceEvent
+    {
+        const char *name;
+        String filename;
+        UInt64 begin;
+        UInt64 end;
+        UInt32 tid;
+    };
+
+    Bool m_enabled;
+    String m_traceFile;
+
+    UInt64 m_origin;
+    UInt64 m_startup;
+
+    mutable std::mutex m_mutex;
+
+    StringMap<FileStats> m_files;
+    std::vector<TraceEvent> m_events;
+
+    //! Trace thread index, in order of first event.
+    std::map<std::thread::id, UInt32> m_threads;
+};
+
+/**
+ * @brief Time a scope, for a phase of a file, and emit the related trace event.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class StatsScope
+{
+public:
+
+    StatsScope(Stats &stats, const char *name, const String &filename, Stats::Phase phase);
+    ~StatsScope();
+
+private:
+
+    Stats &m_stats;
+
+    const char *m_name;
+    String m_filename;
+    Stats::Phase m_phase;
+
+    UInt64 m_begin;
+    UInt64 m_allocs;
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_STATS_H
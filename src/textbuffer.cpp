@@ -0,0 +1,65 @@
+/**
+ * @file textbuffer.cpp
+ * @brief In memory text, line by line, for the sources and the generated files.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "textbuffer.h"
+
+#include <cstdio>
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+TextBuffer::TextBuffer() :
+    m_size(0)
+{
+}
+
+void TextBuffer::writeLine(const String &line)
+{
+    m_lines.push_back(line);
+    m_size += line.length() + 1;
+}
+
+void TextBuffer::clear()
+{
+    m_lines.clear();
+    m_size = 0;
+}
+
+TextReader::TextReader(const T_StringList &lines) :
+    m_lines(lines),
+    m_it(lines.begin())
+{
+}
+
+Int32 TextReader::readLine(String &line)
+{
+    if (m_it == m_lines.end())
+        return EOF;
+
+    line = *m_it;
+    ++m_it;
+
+    return (Int32)line.length();
+}
+
+void TextReader::reset()
+{
+    m_it = m_lines.begin();
+}
+
+UInt64 TextReader::getSize() const
+{
+    UInt64 size = 0;
+    for (const String &line : m_lines)
+    {
+        size += line.length() + 1;
+    }
+
+    return size;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file textbuffer.h
+ * @brief In memory text, line by line, for the sources and the generated files.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _O3D_DMG_TEXTBUFFER_H
+#define _O3D_DMG_TEXTBUFFER_H
+
+#include <o3d/core/string.h>
+#include <o3d/core/stringlist.h>
+
+namespace o3d {
+namespace dmg {
+
+/**
+ * @brief Generated text, filled by the members writers and the templates, and
+ * then given to an OutputSink.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class TextBuffer
+{
+public:
+
+    TextBuffer();
+
+    //! Append a line (the end of line is implicit).
+    void writeLine(const String &line);
+
+    //! Remove any content.
+    void clear();
+
+    const T_StringList& getLines() const { return m_lines; }
+
+    //! Number of characters, counting an end of line per line.
+    UInt64 getSize() const { return m_size; }
+
+private:
+
+    T_StringList m_lines;
+    UInt64 m_size;
+};
+
+/**
+ * @brief Read a list of lines like an input stream (readLine until EOF, reset).
+ * The lines are not copied and must outlive the reader.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class TextReader
+{
+public:
+
+    TextReader(const T_StringList &lines);
+
+    //! Read the next line. Return its length, or EOF at the end.
+    Int32 readLine(String &line);
+
+    //! Restart from the first line.
+    void reset();
+
+    //! Number of characters, counting an end of line per line.
+    UInt64 getSize() const;
+
+private:
+
+    const T_StringList &m_lines;
+    T_StringList::const_iterator m_it;
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_TEXTBUFFER_H
@@ -0,0 +1,160 @@
+/**
+ * @file typedescriptor.cpp
+ * @brief Constant descriptors of the builtin member types.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "typedescriptor.h"
+
+#include <vector>
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+namespace {
+
+constexpr TypeDescriptor descriptors[NUM_BUILTIN_TYPES] = {
+    { "array8", "o3d::SmartArrayUInt8", "read", "write", "", 2, True, True, False },
+    { "bit", "o3d::UInt32", "", "", "", 0, True, False, False },
+    { "bitset16", "o3d::BitSet16", "readUInt16", "writeUInt16", "", 2, True, False, False },
+    { "bitset32", "o3d::BitSet32", "readUInt32", "writeUInt32", "", 4, True, False, False },
+    { "bitset64", "o3d::BitSet64", "readUInt64", "writeUInt64", "", 8, True, False, False },
+    { "bitset8", "o3d::BitSet8", "readUInt8", "writeUInt8", "", 1, True, False, False },
+    { "bool", "o3d::Bool", "readBool", "writeBool", "rnd.nextBool()", 1, True, False, False },
+    { "const int16", "o3d::Int16", "", "", "", 0, True, False, False },
+    { "const int8", "o3d::Int8", "", "", "", 0, True, False, False },
+    { "const uint32", "o3d::UInt32", "", "", "", 0, True, False, False },
+    { "ctor", "ctor", "", "", "", 0, True, False, False },
+    { "double", "o3d::Double", "readDouble", "writeDouble", "rnd.nextDouble()", 8, True, False, False },
+    { "float", "o3d::Float", "readFloat", "writeFloat", "rnd.nextFloat()", 4, True, False, False },
+    { "if", "if", "", "", "", 0, True, False, False },
+    { "immediate", "", "", "", "", 0, True, False, False },
+    { "int16", "o3d::Int16", "readInt16", "writeInt16", "rnd.nextInt16()", 2, True, False, False },
+    { "int32", "o3d::Int32", "readInt32", "writeInt32", "rnd.nextInt32()", 4, True, False, False },
+    { "int64", "o3d::Int64", "readInt64", "writeInt64", "rnd.nextInt64()", 8, True, False, False },
+    { "int8", "o3d::Int8", "readInt8", "writeInt8", "rnd.nextInt8()", 1, True, False, False },
+    { "loop", "loop", "", "", "", 0, True, False, False },
+    { "string", "o3d::String", "readFromFile", "writeToFile", "rnd.nextString()", 2, False, True, False },
+    { "string<>", "DataFixedString", "readFixedString", "writeFixedString", "", 1, False, True, True },
+    { "stringview", "DataStringView", "readStringView", "writeStringView", "", 1, False, True, True },
+    { "uint16", "o3d::UInt16", "readUInt16", "writeUInt16", "rnd.nextUInt16()", 2, True, False, False },
+    { "uint32", "o3d::UInt32", "readUInt32", "writeUInt32", "rnd.nextUInt32()", 4, True, False, False },
+    { "uint32[]", "o3d::UInt32", "read", "write", "", 0, False, True, False },
+    { "uint64", "o3d::UInt64", "readUInt64", "writeUInt64", "rnd.nextUInt64()", 8, True, False, False },
+    { "uint8", "o3d::UInt8", "readUInt8", "writeUInt8", "rnd.nextUInt8()", 1, True, False, False },
+    { "uint8[]", "o3d::UInt8", "read", "write", "", 0, False, True, False },
+    { "utf8string", "std::string", "readUtf8String", "writeUtf8String", "rnd.nextUtf8String()", 1, False, True, True },
+    { "varint32", "o3d::Int32", "readVarInt32", "writeVarInt32", "rnd.nextVarInt32()", 1, False, False, True },
+    { "varint64", "o3d::Int64", "readVarInt64", "writeVarInt64", "rnd.nextVarInt64()", 1, False, False, True },
+    { "varuint32", "o3d::UInt32", "readVarUInt32", "writeVarUInt32", "rnd.nextVarUInt32()", 1, False, False, True },
+    { "varuint64", "o3d::UInt64", "readVarUInt64", "writeVarUInt64", "rnd.nextVarUInt64()", 1, False, False, True }
+};
+
+//
+// Perfect hash of the keywords : the top bits of a seeded FNV-1a. The seed is the
+// first one giving no collision, found offline, and checked at compile time.
+//
+
+constexpr UInt32 HASH_SEED = 70826;
+constexpr UInt32 HASH_BITS = 6;
+constexpr UInt32 HASH_SIZE = 1 << HASH_BITS;
+
+constexpr UInt32 hashStep(UInt32 h, UInt32 c)
+{
+    return (h ^ c) * 16777619u;
+}
+
+constexpr UInt32 hashKeyword(const char *keyword)
+{
+    UInt32 h = 2166136261u ^ HASH_SEED;
+    while (*keyword)
+    {
+        h = hashStep(h, (UInt8)*keyword++);
+    }
+
+    return h >> (32 - HASH_BITS);
+}
+
+struct HashTable
+{
+    Int8 slots[HASH_SIZE];
+    Bool perfect;
+};
+
+constexpr HashTable makeHashTable()
+{
+    HashTable table {};
+    table.perfect = True;
+
+    for (UInt32 i = 0; i < HASH_SIZE; ++i)
+    {
+        table.slots[i] = -1;
+    }
+
+    for (Int32 i = 0; i < NUM_BUILTIN_TYPES; ++i)
+    {
+        UInt32 slot = hashKeyword(descriptors[i].keyword);
+        if (table.slots[slot] != -1)
+            table.perfect = False;
+
+        table.slots[slot] = (Int8)i;
+    }
+
+    return table;
+}
+
+constexpr HashTable hashTable = makeHashTable();
+
+static_assert(hashTable.perfect, "The builtin keywords hash collides, find another seed");
+
+} // anonymous namespace
+
+const TypeDescriptor& o3d::dmg::getTypeDescriptor(BuiltinType type)
+{
+    return descriptors[type];
+}
+
+Int32 o3d::dmg::findBuiltinType(const String &typeName)
+{
+    UInt32 h = 2166136261u ^ HASH_SEED;
+    for (UInt32 i = 0; i < typeName.length(); ++i)
+    {
+        h = hashStep(h, (UInt32)typeName[i]);
+    }
+
+    Int32 type = hashTable.slots[h >> (32 - HASH_BITS)];
+
+    // the slot can be used by another keyword
+    if (type >= 0 && typeName == descriptors[type].keyword)
+        return type;
+
+    return -1;
+}
+
+const TypeStrings& o3d::dmg::getTypeStrings(Int32 type)
+{
+    // the last entry is the empty one, built once in a thread safe way
+    static const std::vector<TypeStrings> strings = [] () {
+        std::vector<TypeStrings> result(NUM_BUILTIN_TYPES + 1);
+
+        for (Int32 i = 0; i < NUM_BUILTIN_TYPES; ++i)
+        {
+            const TypeDescriptor &desc = descriptors[i];
+            TypeStrings &str = result[i];
+
+            str.keyword = desc.keyword;
+            str.outType = desc.outType;
+            str.readMethod = desc.readMethod;
+            str.writeMethod = desc.writeMethod;
+            str.sizeOf = desc.fixed ? String::print("%u", desc.minSize) : String("0");
+            str.benchValue = desc.benchValue;
+        }
+
+        return result;
+    } ();
+
+    return type >= 0 && type < NUM_BUILTIN_TYPES ? strings[type] : strings[NUM_BUILTIN_TYPES];
+}
@@ -0,0 +1,101 @@
+/**
+ * @file typedescriptor.h
+ * @brief Constant descriptors of the builtin member types.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _O3D_DMG_TYPEDESCRIPTOR_H
+#define _O3D_DMG_TYPEDESCRIPTOR_H
+
+#include <o3d/core/string.h>
+
+namespace o3d {
+namespace dmg {
+
+//! Builtin member types, in the order of the descriptors table.
+enum BuiltinType
+{
+    BT_ARRAY8 = 0,
+    BT_BIT,
+    BT_BITSET16,
+    BT_BITSET32,
+    BT_BITSET64,
+    BT_BITSET8,
+    BT_BOOL,
+    BT_CONST_INT16,
+    BT_CONST_INT8,
+    BT_CONST_UINT32,
+    BT_CTOR,
+    BT_DOUBLE,
+    BT_FLOAT,
+    BT_IF,
+    BT_IMMEDIATE,
+    BT_INT16,
+    BT_INT32,
+    BT_INT64,
+    BT_INT8,
+    BT_LOOP,
+    BT_STRING,
+    BT_FIXED_STRING,
+    BT_STRINGVIEW,
+    BT_UINT16,
+    BT_UINT32,
+    BT_UINT32_ARRAY,
+    BT_UINT64,
+    BT_UINT8,
+    BT_UINT8_ARRAY,
+    BT_UTF8STRING,
+    BT_VARINT32,
+    BT_VARINT64,
+    BT_VARUINT32,
+    BT_VARUINT64,
+    NUM_BUILTIN_TYPES
+};
+
+/**
+ * @brief Constant description of a builtin member type, what the members
+ * returned by many virtual getters before.
+ */
+struct TypeDescriptor
+{
+    const char *keyword;       //!< type name into the data files
+    const char *outType;       //!< type name into the generated code
+    const char *readMethod;    //!< read method of the input stream, or empty
+    const char *writeMethod;   //!< write method of the output stream, or empty
+    const char *benchValue;    //!< random value expression of the benchmark, or empty
+    UInt32 minSize;            //!< serialized size in bytes, or minimal size if variable
+    Bool fixed;                //!< True if the serialized size is always minSize
+    Bool ref;                  //!< True if passed by reference to the setters
+    Bool encoded;              //!< True if read and written by the DataEncoding functions
+};
+
+//! Descriptor of a builtin type.
+const TypeDescriptor& getTypeDescriptor(BuiltinType type);
+
+//! Builtin type of a type name, from a perfect hash of the keywords, or -1.
+Int32 findBuiltinType(const String &typeName);
+
+/**
+ * @brief Descriptor converted once to strings, to be returned by reference from
+ * the member getters.
+ */
+struct TypeStrings
+{
+    String keyword;
+    String outType;
+    String readMethod;
+    String writeMethod;
+    String sizeOf;      //!< minSize, or "0" if variable
+    String benchValue;
+};
+
+//! Strings of a builtin type, or empty strings for -1.
+const TypeStrings& getTypeStrings(Int32 type);
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_TYPEDESCRIPTOR_H
@@ -0,0 +1,389 @@
+/**
+ * @file xrefindex.cpp
+ * @brief Cross-reference index of the data files, for the mv and rm commands.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "xrefindex.h"
+#include "memberfactory.h"
+#include "tokenizer.h"
+
+#include <o3d/core/stringtokenizer.h>
+
+using namespace o3d;
+using namespace o3d::dmg;
+
+static const char* kindNames[] = {
+    "declare",
+    "import",
+    "inherit",
+    "value",
+    "ref",
+    "array"
+};
+
+static const UInt32 NUM_KINDS = sizeof(kindNames) / sizeof(const char*);
+
+//! Keywords starting a line without a member type.
+static const char* keywords[] = {
+    "using",
+    "typedef",
+    "template",
+    "target",
+    "identifier",
+    "loop",
+    "if",
+    "public",
+    "const",
+    "header",
+    "class"
+};
+
+static const UInt32 NUM_KEYWORDS = sizeof(keywords) / sizeof(const char*);
+
+static const UInt32 XREF_VERSION = 1;
+
+static Bool isTokenChar(WChar c, Bool dotted)
+{
+    return WideChar::isAlphaNum(c) || c == '_' || (dotted && c == '.');
+}
+
+XRefIndex::XRefIndex()
+{
+}
+
+void XRefIndex::clear()
+{
+    m_sources.clear();
+    m_symbols.clear();
+}
+
+void XRefIndex::scan(const String &source, const T_StringList &lines)
+{
+    T_EntryVector entries;
+    UInt32 lineNum = 0;
+
+    for (const String &line : lines)
+    {
+        ++lineNum;
+
+        // comments and strings are ignored by the tokenizer
+        Tokenizer tk(line, ":<>,{}=");
+        String first = tk.nextToken();
+
+        if (first.isEmpty() || first.startsWith("@") || first == "{" || first == "}")
+            continue;
+
+        Entry entry;
+        entry.line = lineNum;
+
+        if (first == "import")
+        {
+            entry.kind = IMPORT;
+            entry.symbol = tk.nextToken();
+
+            if (entry.symbol.isValid())
+                entries.push_back(entry);
+
+            continue;
+        }
+
+        if (first == "data" || first == "abstract")
+        {
+            String name = tk.nextToken();
+            if (name == "data")
+                name = tk.nextToken();
+
+            if (!tk.isName(name))
+                continue;
+
+            entry.kind = DECLARE;
+            entry.symbol = name;
+            entries.push_back(entry);
+
+            if (tk.nextToken() == ":")
+            {
+                String base = tk.nextToken();
+                if (tk.isName(base))
+                {
+                    entry.kind = INHERIT;
+                    entry.symbol = base;
+                    entries.push_back(entry);
+                }
+            }
+
+            continue;
+        }
+
+        // the type of an extern or static member follows the keyword
+        if (first == "extern" || first == "static")
+            first = tk.nextToken();
+
+        Bool keyword = False;
+        for (UInt32 i = 0; i < NUM_KEYWORDS; ++i)
+        {
+            if (first == keywords[i])
+            {
+                keyword = True;
+                break;
+            }
+        }
+
+        if (keyword)
+            continue;
+
+        // member type
+        entry.kind = VALUE;
+        entry.symbol = first;
+
+        if (first.endsWith("&"))
+        {
+            entry.kind = REF;
+            entry.symbol.trimRight('&');
+        }
+        else if (first.endsWith("[]"))
+        {
+            entry.kind = ARRAY;
+            entry.symbol = first.sub(0, first.length() - 2);
+        }
+
+        if (tk.isName(entry.symbol) && !MemberFactory::isBuiltin(entry.symbol))
+            entries.push_back(entry);
+    }
+
+    remove(source);
+
+    addSymbols(source, entries);
+    m_sources[source] = entries;
+}
+
+void XRefIndex::remove(const String &source)
+{
+    auto it = m_sources.find(source);
+    if (it == m_sources.end())
+        return;
+
+    removeSymbols(source, it->second);
+    m_sources.erase(it);
+}
+
+const XRefIndex::T_EntryVector* XRefIndex::getEntries(const String &source) const
+{
+    auto it = m_sources.find(source);
+    return it != m_sources.end() ? &it->second : nullptr;
+}
+
+void XRefIndex::findSources(const String &symbol, std::set<String> &sources) const
+{
+    auto it = m_symbols.find(symbol);
+    if (it != m_symbols.end())
+        sources.insert(it->second.begin(), it->second.end());
+}
+
+String XRefIndex::findDeclaration(const String &data) const
+{
+    auto it = m_symbols.find(data);
+    if (it == m_symbols.end())
+        return String();
+
+    for (const String &source : it->second)
+    {
+        for (const Entry &entry : m_sources.find(source)->second)
+        {
+            if (entry.kind == DECLARE && entry.symbol == data)
+                return source;
+        }
+    }
+
+    return String();
+}
+
+Bool XRefIndex::read(const T_StringList &lines)
+{
+    clear();
+
+    Bool version = False;
+    String source;
+
+    for (String line : lines)
+    {
+        line.trimLeftChars(" \t");
+        line.trimRightChars(" \t");
+
+        if (line.isEmpty() || line.startsWith("#"))
+            continue;
+
+        StringTokenizer tk(line, " ");
+        String first = tk.nextToken();
+
+        if (first == "version")
+        {
+            version = tk.nextToken().toUInt32() == XREF_VERSION;
+            if (!version)
+                break;
+        }
+        else if (!version)
+        {
+            break;
+        }
+        else if (first == "source")
+        {
+            source = line.sub(7, -1);
+            m_sources[source];
+        }
+        else if (source.isValid() && tk.hasMoreTokens())
+        {
+            Entry entry;
+            entry.line = first.toUInt32();
+
+            String kind = tk.nextToken();
+            UInt32 k = 0;
+            while (k < NUM_KINDS && kind != kindNames[k])
+            {
+                ++k;
+            }
+
+            if (k == NUM_KINDS || !tk.hasMoreTokens())
+            {
+                version = False;
+                break;
+            }
+
+            entry.kind = (Kind)k;
+            entry.symbol = tk.nextToken();
+
+            m_sources[source].push_back(entry);
+            m_symbols[entry.symbol].insert(source);
+        }
+        else
+        {
+            version = False;
+            break;
+        }
+    }
+
+    if (!version)
+        clear();
+
+    return version;
+}
+
+void XRefIndex::write(TextBuffer &buffer) const
+{
+    buffer.writeLine("# datamodelgen cross-reference index, updated by each generation");
+    buffer.writeLine(String::print("version %u", XREF_VERSION));
+
+    for (const std::pair<const String, T_EntryVector> &source : m_sources)
+    {
+        buffer.writeLine("source " + source.first);
+
+        for (const Entry &entry : source.second)
+        {
+            buffer.writeLine(String::print("%u ", entry.line) + kindNames[entry.kind] + " " + entry.symbol);
+        }
+    }
+}
+
+const char* XRefIndex::getKindName(Kind kind)
+{
+    return kindNames[kind];
+}
+
+Bool XRefIndex::rewrite(
+        T_StringList &lines,
+        const String &fromImport,
+        const String &toImport,
+        const String &fromData,
+        const String &toData)
+{
+    Bool changed = False;
+
+    for (String &line : lines)
+    {
+        String trimmed = line;
+        trimmed.trimLeftChars(" \t");
+
+        if (trimmed.startsWith("#"))
+            continue;
+
+        if (trimmed.startsWith("import"))
+        {
+            if (fromImport.isValid() && renameToken(line, fromImport, toImport, True))
+                changed = True;
+        }
+        else if (fromData.isValid() && fromData != toData)
+        {
+            if (renameToken(line, fromData, toData, False))
+                changed = True;
+        }
+    }
+
+    return changed;
+}
+
+Bool XRefIndex::renameToken(String &line, const String &from, const String &to, Bool dotted)
+{
+    if (from.isEmpty())
+        return False;
+
+    String result;
+    Bool renamed = False;
+
+    UInt32 n = 0;
+    while (n < line.length())
+    {
+        if (!isTokenChar(line[n], dotted))
+        {
+            result += line[n];
+            ++n;
+            continue;
+        }
+
+        UInt32 begin = n;
+        while (n < line.length() && isTokenChar(line[n], dotted))
+        {
+            ++n;
+        }
+
+        String token = line.sub(begin, n);
+        if (token == from)
+        {
+            result += to;
+            renamed = True;
+        }
+        else
+        {
+            result += token;
+        }
+    }
+
+    if (renamed)
+        line = result;
+
+    return renamed;
+}
+
+void XRefIndex::addSymbols(const String &source, const T_EntryVector &entries)
+{
+    for (const Entry &entry : entries)
+    {
+        m_symbols[entry.symbol].insert(source);
+    }
+}
+
+void XRefIndex::removeSymbols(const String &source, const T_EntryVector &entries)
+{
+    for (const Entry &entry : entries)
+    {
+        auto it = m_symbols.find(entry.symbol);
+        if (it == m_symbols.end())
+            continue;
+
+        it->second.erase(source);
+        if (it->second.empty())
+            m_symbols.erase(it);
+    }
+}
@@ -0,0 +1,128 @@
+/**
+ * @file xrefindex.h
+ * @brief Cross-reference index of the data files, for the mv and rm commands.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _O3D_DMG_XREFINDEX_H
+#define _O3D_DMG_XREFINDEX_H
+
+#include <o3d/core/stringlist.h>
+#include "textbuffer.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace o3d {
+namespace dmg {
+
+/**
+ * @brief Symbols declared and referenced by each data file : data declarations,
+ * imports, inheritances and members of data types (values, refs and arrays).
+ * It is updated by the parse of the files, persisted by the generator after a
+ * run, and used to find the files affected by renaming or removing a data file
+ * without scanning the whole tree.
+ * Sources are named relative to the input path ("pkg/Model.dmg"), imports as into
+ * the data files ("pkg.Model").
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ */
+class XRefIndex
+{
+public:
+
+    enum Kind
+    {
+        DECLARE = 0,   //!< data or abstract declaration
+        IMPORT,        //!< import of a data file
+        INHERIT,       //!< inheritance
+        VALUE,         //!< custom member of a data type
+        REF,           //!< custom reference (Type&)
+        ARRAY          //!< custom array (Type[])
+    };
+
+    struct Entry
+    {
+        Kind kind;
+        String symbol;
+        UInt32 line;    //!< starting from 1
+    };
+
+    typedef std::vector<Entry> T_EntryVector;
+
+    XRefIndex();
+
+    //! Remove every source.
+    void clear();
+
+    //! Replace the entries of a source by scanning its lines.
+    void scan(const String &source, const T_StringList &lines);
+
+    //! Remove a source.
+    void remove(const String &source);
+
+    //! Entries of a source, or nullptr if not indexed.
+    const T_EntryVector* getEntries(const String &source) const;
+
+    //! Sources referencing a symbol, a data name or an import, sorted by name.
+    void findSources(const String &symbol, std::set<String> &sources) const;
+
+    //! Source declaring a data, or an empty string.
+    String findDeclaration(const String &data) const;
+
+    //! Number of indexed sources.
+    size_t getNumSources() const { return m_sources.size(); }
+
+    //! Entries of each source, sorted by source name.
+    const std::map<String, T_EntryVector>& getSources() const { return m_sources; }
+
+    //! Read a persisted index. Return False, and let the index empty, if the format is unknown.
+    Bool read(const T_StringList &lines);
+
+    //! Persist the index, sources and entries sorted, so the content is stable.
+    void write(TextBuffer &buffer) const;
+
+    //! Name of an entry kind, as persisted.
+    static const char* getKindName(Kind kind);
+
+    /**
+     * @brief Rename an imported file and a data into the lines of a data file. Only
+     * whole tokens are replaced (MAX_Model is not a reference to Model), and comment
+     * lines are kept.
+     * @param fromImport Imported file ("pkg.Model"), or empty to keep the imports.
+     * @param fromData Data name, or empty to keep the names.
+     * @return True if a line changed.
+     */
+    static Bool rewrite(
+            T_StringList &lines,
+            const String &fromImport,
+            const String &toImport,
+            const String &fromData,
+            const String &toData);
+
+    /**
+     * @brief Replace the whole tokens equal to from into a line.
+     * @param dotted If True a token can contain dots (an import path).
+     * @return True if replaced.
+     */
+    static Bool renameToken(String &line, const String &from, const String &to, Bool dotted);
+
+private:
+
+    std::map<String, T_EntryVector> m_sources;
+
+    //! Reverse index, symbol to referencing sources.
+    std::map<String, std::set<String>> m_symbols;
+
+    void addSymbols(const String &source, const T_EntryVector &entries);
+    void removeSymbols(const String &source, const T_EntryVector &entries);
+};
+
+} // namespace dmg
+} // namespace o3d
+
+#endif // _O3D_DMG_XREFINDEX_H
@@ -0,0 +1,41 @@
+/**
+ * @file Point.h
+ * @brief Typedef class of the custom array of the arena test, trivially destructible.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _DMG_TEST_POINT_H
+#define _DMG_TEST_POINT_H
+
+#include <o3d/core/base.h>
+#include <o3d/core/InStream.h>
+#include <o3d/core/OutStream.h>
+
+namespace tsd {
+
+struct Point
+{
+    o3d::Int32 x = 0;
+    o3d::Int32 y = 0;
+
+    o3d::Bool readFromFile(o3d::InStream &is)
+    {
+        x = is.readInt32();
+        y = is.readInt32();
+        return o3d::True;
+    }
+
+    o3d::Bool writeToFile(o3d::OutStream &os) const
+    {
+        os.writeInt32(x);
+        os.writeInt32(y);
+        return o3d::True;
+    }
+};
+
+} // namespace tsd
+
+#endif // _DMG_TEST_POINT_H
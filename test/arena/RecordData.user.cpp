@@ -0,0 +1,34 @@
+/**
+ * @file RecordData.user.cpp
+ * @brief User implementation of the generated RecordData, copied before the generation,
+ * which keeps it. It reads the private members for the test.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "RecordData.h"
+#include "arenatest.h"
+
+using namespace tsd;
+using namespace o3d;
+
+void RecordData::postImport()
+{
+    UInt64 sum = (UInt64)m_id;
+
+    sum += (UInt64)m_tag.getValue() + m_tag.getName().length();
+
+    for (const Point &point : m_points)
+    {
+        sum += (UInt64)point.x + (UInt64)point.y;
+    }
+
+    for (UInt32 i = 0; i < m_count; ++i)
+    {
+        sum += (UInt64)m_itemsArray[i].m_value + m_itemsArray[i].m_label.length();
+    }
+
+    gRecordChecksum = sum;
+}
@@ -0,0 +1,22 @@
+/**
+ * @file arenatest.h
+ * @brief Generated readers with arena = true and pool = true.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#ifndef _DMG_TEST_ARENATEST_H
+#define _DMG_TEST_ARENATEST_H
+
+#include <o3d/core/base.h>
+
+namespace tsd {
+
+//! Sum of the values and of the lengths of the strings, given by RecordData::postImport.
+extern o3d::UInt64 gRecordChecksum;
+
+} // namespace tsd
+
+#endif // _DMG_TEST_ARENATEST_H
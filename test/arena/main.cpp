@@ -0,0 +1,299 @@
+/**
+ * @file main.cpp
+ * @brief Read records with arena = true and pool = true, across arena resets, and check
+ * their values. Return non-zero on failure.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "RecordData.h"
+#include "arenatest.h"
+
+#include <o3d/core/OutStream.h>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace tsd;
+
+o3d::UInt64 tsd::gRecordChecksum = 0;
+
+namespace {
+
+/**
+ * @brief Output stream appending to a vector, for the records written by hand (the
+ * generator exports only the reader here).
+ */
+class VectorOutStream : public o3d::OutStream
+{
+public:
+
+    std::vector<o3d::UInt8> data;
+
+    virtual o3d::UInt32 writer(const void *buf, o3d::UInt32 size, o3d::UInt32 count)
+    {
+        const o3d::UInt8 *p = (const o3d::UInt8*)buf;
+        data.insert(data.end(), p, p + size * count);
+
+        return count;
+    }
+
+    virtual void close() {}
+    virtual void flush() {}
+    virtual void reset(o3d::UInt64 n) { data.resize((size_t)n); }
+    virtual void seek(o3d::Int64) {}
+    virtual void end(o3d::Int64) {}
+    virtual o3d::Int32 getPosition() const { return (o3d::Int32)data.size(); }
+};
+
+//! Tag names long enough to be allocated on the heap.
+o3d::String name(o3d::Int32 n)
+{
+    o3d::String s("a tag name long enough to be allocated on the heap #");
+    for (o3d::Int32 i = 0; i <= n % 7; ++i)
+    {
+        s += 'x';
+    }
+
+    return s;
+}
+
+//! Write count records of seed, as RecordData reads them, and return their checksums.
+std::vector<o3d::UInt64> writeRecords(VectorOutStream &os, o3d::Int32 seed, o3d::UInt32 count)
+{
+    std::vector<o3d::UInt64> sums;
+
+    for (o3d::UInt32 r = 0; r < count; ++r)
+    {
+        o3d::Int32 id = seed * 100 + (o3d::Int32)r;
+        o3d::UInt64 sum = (o3d::UInt64)id;
+
+        os.writeInt32(id);
+
+        o3d::String tagName = name(id);
+        os.writeInt32(seed);
+        tagName.writeToFile(os);
+        sum += (o3d::UInt64)seed + tagName.length();
+
+        // the same counts from a round to the other, so the elements could be reused
+        o3d::UInt32 numPoints = 1 + r % 3;
+        os.writeUInt32(numPoints);
+        for (o3d::UInt32 i = 0; i < numPoints; ++i)
+        {
+            os.writeInt32(id + (o3d::Int32)i);
+            os.writeInt32(seed);
+
+            sum += (o3d::UInt64)(id + (o3d::Int32)i) + (o3d::UInt64)seed;
+        }
+
+        o3d::UInt16 numItems = (o3d::UInt16)(2 + r % 2);
+        os.writeUInt16(numItems);
+        for (o3d::UInt16 i = 0; i < numItems; ++i)
+        {
+            o3d::UInt8 length = (o3d::UInt8)(1 + (id + i) % 24);
+            os.writeInt32(id + i);
+            os.writeUInt8(length);
+            for (o3d::UInt8 c = 0; c < length; ++c)
+            {
+                os.writeUInt8((o3d::UInt8)('a' + c));
+            }
+
+            sum += (o3d::UInt64)(id + i) + length;
+        }
+
+        sums.push_back(sum);
+    }
+
+    return sums;
+}
+
+//! Overwrite the memory of the arena given back by a reset.
+void scribble(DataArena &arena)
+{
+    void *p = arena.allocate(32 * 1024);
+    std::memset(p, 0xab, 32 * 1024);
+}
+
+o3d::Int32 failures = 0;
+
+void check(o3d::Bool cond, const char *what, o3d::Int32 round)
+{
+    if (!cond)
+    {
+        std::printf("FAILED: %s (round %d)\n", what, round);
+        ++failures;
+    }
+}
+
+//! Read the records through a pool, twice by arena load, and release them before the reset
+//! of the arena.
+void testPool()
+{
+    DataArena arena;
+    RecordData::Pool pool;
+
+    for (o3d::Int32 round = 0; round < 8; ++round)
+    {
+        VectorOutStream os;
+        std::vector<o3d::UInt64> sums = writeRecords(os, round + 1, 16);
+
+        DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+        std::vector<RecordData*> records;
+
+        {
+            DataArenaScope scope(arena);
+            for (size_t i = 0; i < sums.size(); ++i)
+            {
+                records.push_back(pool.read(is));
+            }
+        }
+
+        check(arena.getUsed() > 0, "the arrays are allocated from the arena", round);
+
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            records[i]->postImport();
+            check(gRecordChecksum == sums[i], "pooled record values", round);
+        }
+
+        // last in first out, so each record is read again into the same object
+        for (size_t i = records.size(); i > 0; --i)
+        {
+            pool.release(records[i - 1]);
+        }
+
+        // the same records again, into the storage kept by the reset
+        size_t used = arena.getUsed();
+        is.reset(0);
+
+        {
+            DataArenaScope scope(arena);
+            for (size_t i = 0; i < sums.size(); ++i)
+            {
+                records[i] = pool.read(is);
+            }
+        }
+
+        check(arena.getUsed() == used, "the arrays are read into their kept storage", round);
+
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            records[i]->postImport();
+            check(gRecordChecksum == sums[i], "pooled record values read again", round);
+            pool.release(records[i]);
+        }
+
+        arena.reset();
+        scribble(arena);
+        arena.reset();
+    }
+}
+
+//! Read again the same record, reset before each arena reset.
+void testReadAgain()
+{
+    DataArena arena;
+    RecordData record;
+
+    for (o3d::Int32 round = 0; round < 4; ++round)
+    {
+        VectorOutStream os;
+        std::vector<o3d::UInt64> sums = writeRecords(os, round + 1, 1);
+
+        DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+        record.readFromFile(is, arena);
+
+        record.postImport();
+        check(gRecordChecksum == sums[0], "record read again", round);
+
+        // before the arena reset
+        record.reset();
+
+        arena.reset();
+        scribble(arena);
+    }
+
+    // then from the heap, no arena
+    VectorOutStream os;
+    std::vector<o3d::UInt64> sums = writeRecords(os, 9, 1);
+
+    DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+    record.readFromFile(is);
+
+    record.postImport();
+    check(gRecordChecksum == sums[0], "record read from the heap", 0);
+}
+
+//! Destroy the records, then reset their arena : nothing leaks (LeakSanitizer).
+void testDestroyBeforeReset()
+{
+    DataArena arena;
+
+    for (o3d::Int32 round = 0; round < 4; ++round)
+    {
+        VectorOutStream os;
+        std::vector<o3d::UInt64> sums = writeRecords(os, round + 1, 4);
+
+        DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+        std::vector<RecordData> records(sums.size());
+
+        {
+            DataArenaScope scope(arena);
+            for (RecordData &record : records)
+            {
+                record.readFromFile(is);
+            }
+        }
+
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            records[i].postImport();
+            check(gRecordChecksum == sums[i], "record destroyed before the reset", round);
+        }
+
+        records.clear();
+        arena.reset();
+        scribble(arena);
+    }
+}
+
+//! Misuse : destroy a record after the reset of its arena, asserting in debug.
+void destroyAfterReset()
+{
+    DataArena arena;
+
+    VectorOutStream os;
+    writeRecords(os, 1, 1);
+
+    DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+    RecordData *record = new RecordData();
+    record->readFromFile(is, arena);
+
+    arena.reset();
+    delete record;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    // expected to fail, in debug only
+    if (argc > 1 && std::strcmp(argv[1], "--destroy-after-reset") == 0)
+    {
+        destroyAfterReset();
+        return 0;
+    }
+
+    testPool();
+    testReadAgain();
+    testDestroyBeforeReset();
+
+    if (failures > 0)
+        return 1;
+
+    std::printf("arena test passed\n");
+    return 0;
+}
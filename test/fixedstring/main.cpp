@@ -0,0 +1,206 @@
+/**
+ * @file main.cpp
+ * @brief Assign, write and read bounded strings at and beyond their capacity, and check
+ * that the longer ones are rejected, into DataFixedString and into CodeData. Return
+ * non-zero on failure.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "CodeData.h"
+#include "DataEncoding.h"
+
+#include <o3d/core/OutStream.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace tsf;
+
+namespace {
+
+/**
+ * @brief Output stream appending to a vector.
+ */
+class VectorOutStream : public o3d::OutStream
+{
+public:
+
+    std::vector<o3d::UInt8> data;
+
+    virtual o3d::UInt32 writer(const void *buf, o3d::UInt32 size, o3d::UInt32 count)
+    {
+        const o3d::UInt8 *p = (const o3d::UInt8*)buf;
+        data.insert(data.end(), p, p + size * count);
+
+        return count;
+    }
+
+    virtual void close() {}
+    virtual void flush() {}
+    virtual void reset(o3d::UInt64 n) { data.resize((size_t)n); }
+    virtual void seek(o3d::Int64) {}
+    virtual void end(o3d::Int64) {}
+    virtual o3d::Int32 getPosition() const { return (o3d::Int32)data.size(); }
+};
+
+o3d::Int32 failures = 0;
+
+void check(o3d::Bool cond, const char *what)
+{
+    if (!cond)
+    {
+        std::printf("FAILED: %s\n", what);
+        ++failures;
+    }
+}
+
+//! True if assigning str to a DataFixedString<N> throws E_InvalidParameter.
+template <o3d::UInt32 N>
+o3d::Bool isAssignRejected(const std::string &str)
+{
+    try {
+        DataFixedString<N> s(str.c_str());
+    } catch (const o3d::E_InvalidParameter &) {
+        return o3d::True;
+    }
+
+    return o3d::False;
+}
+
+void testAssign()
+{
+    check(!isAssignRejected<1>("a"), "string<1> of 1 byte accepted");
+    check(isAssignRejected<1>("ab"), "string<1> of 2 bytes rejected");
+
+    check(!isAssignRejected<8>(std::string(8, 'x')), "string<8> of 8 bytes accepted");
+    check(isAssignRejected<8>(std::string(9, 'x')), "string<8> of 9 bytes rejected");
+
+    check(!isAssignRejected<255>(std::string(255, 'x')), "string<255> of 255 bytes accepted");
+    check(isAssignRejected<255>(std::string(256, 'x')), "string<255> of 256 bytes rejected");
+
+    // full, null terminated
+    DataFixedString<8> s("abcdefgh");
+    check(s.length() == 8 && std::strcmp(s.c_str(), "abcdefgh") == 0, "string<8> full");
+
+    // a rejected assign keeps the previous string
+    try {
+        s.assign("abcdefghi", 9);
+    } catch (const o3d::E_InvalidParameter &) {
+    }
+
+    check(s == DataFixedString<8>("abcdefgh"), "string kept by a rejected assign");
+
+    // the length of a view is checked too, not its null terminator
+    check(DataFixedString<4>(DataStringView("abcdefgh", 4)).length() == 4, "view of 4 bytes accepted");
+}
+
+//! True if reading a DataFixedString<N> from bytes throws E_InvalidFormat.
+template <o3d::UInt32 N>
+o3d::Bool isReadRejected(const std::vector<o3d::UInt8> &bytes)
+{
+    try {
+        DataMemoryInStream is(bytes.data(), (o3d::UInt32)bytes.size());
+        readFixedString<N>(is);
+    } catch (const o3d::E_InvalidFormat &) {
+        return o3d::True;
+    }
+
+    return o3d::False;
+}
+
+//! The length byte then length bytes.
+std::vector<o3d::UInt8> written(o3d::UInt32 length)
+{
+    std::vector<o3d::UInt8> bytes(1 + length, 'x');
+    bytes[0] = (o3d::UInt8)length;
+
+    return bytes;
+}
+
+void testRead()
+{
+    check(!isReadRejected<8>(written(0)), "empty string<8> read");
+    check(!isReadRejected<8>(written(8)), "string<8> of 8 bytes read");
+    check(isReadRejected<8>(written(9)), "string<8> of 9 bytes rejected");
+    check(isReadRejected<8>(written(255)), "string<8> of 255 bytes rejected");
+    check(!isReadRejected<255>(written(255)), "string<255> of 255 bytes read");
+
+    // truncated, fewer bytes than the length
+    std::vector<o3d::UInt8> truncated = written(8);
+    truncated.pop_back();
+    check(isReadRejected<8>(truncated), "truncated string<8> rejected");
+
+    // write then read
+    VectorOutStream os;
+    writeFixedString(os, DataFixedString<8>("code"));
+    check(os.data.size() == 5, "string<8> written size");
+
+    DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+    check(readFixedString<8>(is) == DataFixedString<8>("code"), "string<8> read back");
+}
+
+//! Written as CodeData reads it (the generator exports only the reader here).
+void writeCode(o3d::OutStream &os, const std::string &grade, const std::string &code, const std::string &title)
+{
+    for (const std::string *s : { &grade, &code, &title })
+    {
+        os.writeUInt8((o3d::UInt8)s->size());
+        os.write(s->data(), (o3d::UInt32)s->size());
+    }
+}
+
+void testRecord()
+{
+    VectorOutStream os;
+    writeCode(os, "A", "ABCDEFGH", std::string(255, 't'));
+
+    CodeData record;
+
+    {
+        DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+        record.readFromFile(is);
+
+        check(record.getGrade() == DataFixedString<1>("A") && record.getCode() == DataFixedString<8>("ABCDEFGH") &&
+              record.getTitle().length() == 255 && record.getTitle().c_str()[255] == 0, "record at the capacities");
+    }
+
+    // a code of 9 bytes, beyond string<8>
+    VectorOutStream longer;
+    writeCode(longer, "A", "ABCDEFGHI", "title");
+
+    o3d::Bool rejected = o3d::False;
+    try {
+        DataMemoryInStream is(longer.data.data(), (o3d::UInt32)longer.data.size());
+        record.readFromFile(is);
+    } catch (const o3d::E_InvalidFormat &) {
+        rejected = o3d::True;
+    }
+
+    check(rejected, "record of a longer code rejected");
+
+    // the member failing keeps its previous string
+    check(record.getCode() == DataFixedString<8>("ABCDEFGH"), "code kept by a rejected read");
+
+    record.reset();
+    check(record.getGrade().isEmpty() && record.getCode().isEmpty() && record.getTitle().isEmpty(), "record reset");
+}
+
+} // anonymous namespace
+
+int main()
+{
+    testAssign();
+    testRead();
+    testRecord();
+
+    if (failures > 0)
+        return 1;
+
+    std::printf("fixedstring test passed\n");
+    return 0;
+}
@@ -0,0 +1,300 @@
+/**
+ * @file main.cpp
+ * @brief Round-trip the LZ4 codec of the packs, then write and read packs of SampleData,
+ * and check that the truncated or corrupted ones are rejected. Return non-zero on failure.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "SampleData.h"
+#include "DataPack.h"
+
+#include <o3d/core/OutStream.h>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace tsp;
+
+namespace {
+
+/**
+ * @brief Output stream appending to a vector.
+ */
+class VectorOutStream : public o3d::OutStream
+{
+public:
+
+    std::vector<o3d::UInt8> data;
+
+    virtual o3d::UInt32 writer(const void *buf, o3d::UInt32 size, o3d::UInt32 count)
+    {
+        const o3d::UInt8 *p = (const o3d::UInt8*)buf;
+        data.insert(data.end(), p, p + size * count);
+
+        return count;
+    }
+
+    virtual void close() {}
+    virtual void flush() {}
+    virtual void reset(o3d::UInt64 n) { data.resize((size_t)n); }
+    virtual void seek(o3d::Int64) {}
+    virtual void end(o3d::Int64) {}
+    virtual o3d::Int32 getPosition() const { return (o3d::Int32)data.size(); }
+};
+
+/**
+ * @brief Written as SampleData reads it (the generator exports only the reader here).
+ */
+struct SampleWriter
+{
+    o3d::Int32 id;
+    o3d::String name;
+
+    o3d::Bool writeToFile(o3d::OutStream &os) const
+    {
+        os.writeInt32(id);
+        name.writeToFile(os);
+
+        return o3d::True;
+    }
+};
+
+o3d::Int32 failures = 0;
+
+void check(o3d::Bool cond, const char *what)
+{
+    if (!cond)
+    {
+        std::printf("FAILED: %s\n", what);
+        ++failures;
+    }
+}
+
+//! Pseudo random bytes, incompressible.
+std::vector<o3d::UInt8> noise(o3d::UInt32 n)
+{
+    std::vector<o3d::UInt8> data(n);
+    o3d::UInt32 x = 2463534242u;
+
+    for (o3d::UInt8 &b : data)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        b = (o3d::UInt8)x;
+    }
+
+    return data;
+}
+
+//! Compress then decompress src, and compare. Return the compressed size.
+o3d::UInt32 roundTrip(const std::vector<o3d::UInt8> &src, const char *what)
+{
+    o3d::UInt32 n = (o3d::UInt32)src.size();
+
+    std::vector<o3d::UInt8> packed(DataLZ4::bound(n));
+    o3d::UInt32 packedSize = DataLZ4::compress(src.data(), n, packed.data());
+    check(packedSize <= DataLZ4::bound(n), what);
+
+    std::vector<o3d::UInt8> raw(n);
+    check(DataLZ4::decompress(packed.data(), packedSize, raw.data(), n), what);
+    check(raw == src, what);
+
+    return packedSize;
+}
+
+void testLZ4()
+{
+    // empty input, a single token
+    check(roundTrip(std::vector<o3d::UInt8>(), "LZ4 empty input") == 1, "LZ4 empty input size");
+
+    // shorter than a match
+    roundTrip(std::vector<o3d::UInt8>(7, 'a'), "LZ4 short input");
+
+    // repeated, overlapping matches (offset 1) and long length bytes
+    check(roundTrip(std::vector<o3d::UInt8>(100000, 'z'), "LZ4 repeated byte") < 1000,
+          "LZ4 repeated byte compressed");
+
+    std::vector<o3d::UInt8> text;
+    for (o3d::UInt32 i = 0; i < 5000; ++i)
+    {
+        const char *word = (i % 3) ? "record " : "pack block ";
+        text.insert(text.end(), word, word + std::strlen(word));
+        text.push_back((o3d::UInt8)('0' + i % 10));
+    }
+
+    check(roundTrip(text, "LZ4 text") < text.size() / 2, "LZ4 text compressed");
+
+    // incompressible, expanded by the literal lengths only
+    std::vector<o3d::UInt8> random = noise(70000);
+    check(roundTrip(random, "LZ4 incompressible") > random.size(), "LZ4 incompressible expanded");
+
+    // corrupted : truncated input, wrong size, offset before the start
+    std::vector<o3d::UInt8> packed(DataLZ4::bound((o3d::UInt32)text.size()));
+    o3d::UInt32 packedSize = DataLZ4::compress(text.data(), (o3d::UInt32)text.size(), packed.data());
+    std::vector<o3d::UInt8> raw(text.size() + 1);
+
+    check(!DataLZ4::decompress(packed.data(), packedSize / 2, raw.data(), (o3d::UInt32)text.size()),
+          "LZ4 truncated input rejected");
+    check(!DataLZ4::decompress(packed.data(), packedSize, raw.data(), (o3d::UInt32)text.size() - 1),
+          "LZ4 smaller output rejected");
+    check(!DataLZ4::decompress(packed.data(), packedSize, raw.data(), (o3d::UInt32)text.size() + 1),
+          "LZ4 larger output rejected");
+
+    const o3d::UInt8 badOffset[] = { 0x10, 'a', 0x05, 0x00, 0x00 };
+    check(!DataLZ4::decompress(badOffset, sizeof(badOffset), raw.data(), 5), "LZ4 bad offset rejected");
+}
+
+//! Pack of count samples, small blocks so there are many.
+std::vector<o3d::UInt8> writePack(o3d::UInt32 count)
+{
+    VectorOutStream os;
+    DataPackWriter writer(os, 512);
+
+    for (o3d::UInt32 i = 0; i < count; ++i)
+    {
+        SampleWriter sample;
+        sample.id = (o3d::Int32)i;
+        sample.name = o3d::String("sample ") + (i % 2 ? "odd" : "even");
+
+        writer.write(sample);
+    }
+
+    writer.finish();
+    return os.data;
+}
+
+o3d::Bool isSample(const SampleData &sample, o3d::UInt32 i)
+{
+    return sample.getId() == (o3d::Int32)i &&
+           sample.getName() == o3d::String("sample ") + (i % 2 ? "odd" : "even");
+}
+
+void testPack()
+{
+    std::vector<o3d::UInt8> data = writePack(1000);
+
+    DataMemoryInStream is(data.data(), (o3d::UInt32)data.size());
+    DataPackReader reader(is);
+
+    check(reader.getNumRecords() == 1000, "pack records");
+    check(reader.getNumBlocks() > 1, "pack blocks");
+    check(reader.getBlock(0).packedSize < reader.getBlock(0).rawSize, "pack block compressed");
+
+    std::vector<SampleData> records;
+    reader.readAll(records, 4);
+
+    o3d::Bool same = records.size() == 1000;
+    for (o3d::UInt32 i = 0; same && i < records.size(); ++i)
+    {
+        same = isSample(records[i], i);
+    }
+
+    check(same, "pack read by threads");
+
+    // random access
+    std::vector<SampleData> some;
+    o3d::UInt32 b = reader.findBlock(777);
+    reader.readBlock(b, some);
+
+    const DataPack::Block &block = reader.getBlock(b);
+    check(777 >= block.firstRecord && 777 < block.firstRecord + block.numRecords, "pack find block");
+    check(some.size() == block.numRecords && isSample(some[777 - block.firstRecord], 777), "pack read block");
+
+    // empty
+    std::vector<o3d::UInt8> empty = writePack(0);
+    DataMemoryInStream emptyIs(empty.data(), (o3d::UInt32)empty.size());
+    DataPackReader emptyReader(emptyIs);
+
+    records.clear();
+    emptyReader.readAll(records);
+    check(emptyReader.getNumBlocks() == 0 && records.empty(), "empty pack");
+}
+
+//! True if reading every record of data throws E_InvalidFormat.
+o3d::Bool isRejected(const std::vector<o3d::UInt8> &data)
+{
+    try {
+        DataMemoryInStream is(data.data(), (o3d::UInt32)data.size());
+        DataPackReader reader(is);
+
+        std::vector<SampleData> records;
+        reader.readAll(records, 2);
+    } catch (const o3d::E_InvalidFormat &) {
+        return o3d::True;
+    }
+
+    return o3d::False;
+}
+
+void put32(std::vector<o3d::UInt8> &data, size_t pos, o3d::UInt32 v)
+{
+    for (o3d::UInt32 i = 0; i < 4; ++i)
+    {
+        data[pos + i] = (o3d::UInt8)(v >> (8 * i));
+    }
+}
+
+void testRejected()
+{
+    const std::vector<o3d::UInt8> data = writePack(1000);
+
+    check(!isRejected(data), "valid pack accepted");
+
+    // truncated, the footer is lost
+    check(isRejected(std::vector<o3d::UInt8>(data.begin(), data.end() - 10)), "truncated pack rejected");
+    check(isRejected(std::vector<o3d::UInt8>(data.begin(), data.begin() + 8)), "header only rejected");
+
+    // the first block, compressed, is overwritten
+    std::vector<o3d::UInt8> corrupted = data;
+    for (size_t i = DataPack::HEADER_SIZE; i < DataPack::HEADER_SIZE + 16; ++i)
+    {
+        corrupted[i] = 0xff;
+    }
+
+    check(isRejected(corrupted), "corrupted block rejected");
+
+    // index entries, before the footer
+    const size_t footer = data.size() - DataPack::FOOTER_SIZE;
+    o3d::UInt32 numBlocks = data[footer] | (data[footer + 1] << 8) | (data[footer + 2] << 16) | (data[footer + 3] << 24);
+    const size_t index = footer - numBlocks * DataPack::ENTRY_SIZE;
+
+    // the second block overlaps the records of the first one
+    std::vector<o3d::UInt8> overlapping = data;
+    put32(overlapping, index + DataPack::ENTRY_SIZE + 16, 0);
+    check(isRejected(overlapping), "overlapping blocks rejected");
+
+    // the last block goes beyond the number of records
+    std::vector<o3d::UInt8> beyond = data;
+    put32(beyond, index + (numBlocks - 1) * DataPack::ENTRY_SIZE + 20, 1000000);
+    check(isRejected(beyond), "records beyond the count rejected");
+
+    // a block claiming more bytes than the pack has
+    std::vector<o3d::UInt8> larger = data;
+    put32(larger, index + 8, 0x7fffffff);
+    check(isRejected(larger), "block larger than the pack rejected");
+
+    // more blocks than the index has
+    std::vector<o3d::UInt8> count = data;
+    put32(count, footer, numBlocks + 1);
+    check(isRejected(count), "block count rejected");
+}
+
+} // anonymous namespace
+
+int main()
+{
+    testLZ4();
+    testPack();
+    testRejected();
+
+    if (failures > 0)
+        return 1;
+
+    std::printf("pack test passed\n");
+    return 0;
+}
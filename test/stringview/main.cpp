@@ -0,0 +1,233 @@
+/**
+ * @file main.cpp
+ * @brief Read records of string views from a buffer and from a pack, and check that their
+ * views stay valid across the next reads, as long as the buffer or the pack reader.
+ * Return non-zero on failure.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "EntryData.h"
+#include "DataPack.h"
+
+#include <o3d/core/OutStream.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace tsw;
+
+namespace {
+
+/**
+ * @brief Output stream appending to a vector.
+ */
+class VectorOutStream : public o3d::OutStream
+{
+public:
+
+    std::vector<o3d::UInt8> data;
+
+    virtual o3d::UInt32 writer(const void *buf, o3d::UInt32 size, o3d::UInt32 count)
+    {
+        const o3d::UInt8 *p = (const o3d::UInt8*)buf;
+        data.insert(data.end(), p, p + size * count);
+
+        return count;
+    }
+
+    virtual void close() {}
+    virtual void flush() {}
+    virtual void reset(o3d::UInt64 n) { data.resize((size_t)n); }
+    virtual void seek(o3d::Int64) {}
+    virtual void end(o3d::Int64) {}
+    virtual o3d::Int32 getPosition() const { return (o3d::Int32)data.size(); }
+};
+
+o3d::Int32 failures = 0;
+
+void check(o3d::Bool cond, const char *what)
+{
+    if (!cond)
+    {
+        std::printf("FAILED: %s\n", what);
+        ++failures;
+    }
+}
+
+std::string label(o3d::UInt32 i)
+{
+    return "label " + std::to_string(i);
+}
+
+//! Long enough to be allocated on the heap if it was copied.
+std::string note(o3d::UInt32 i)
+{
+    return std::string(16 + i % 48, (char)('a' + i % 26));
+}
+
+/**
+ * @brief Written as EntryData reads it (the generator exports only the reader here).
+ */
+struct EntryWriter
+{
+    o3d::Int32 id;
+    std::string label;
+    std::string note;
+
+    o3d::Bool writeToFile(o3d::OutStream &os) const
+    {
+        os.writeInt32(id);
+        writeStringView(os, DataStringView(label.c_str()));
+        writeStringView(os, DataStringView(note.c_str()));
+
+        return o3d::True;
+    }
+};
+
+EntryWriter entry(o3d::UInt32 i)
+{
+    EntryWriter writer;
+    writer.id = (o3d::Int32)i;
+    writer.label = label(i);
+    writer.note = note(i);
+
+    return writer;
+}
+
+o3d::Bool isEntry(const EntryData &data, o3d::UInt32 i)
+{
+    return data.getId() == (o3d::Int32)i &&
+           data.getLabel() == DataStringView(label(i).c_str()) &&
+           data.getNote() == DataStringView(note(i).c_str());
+}
+
+o3d::Bool isInto(const DataStringView &view, const std::vector<o3d::UInt8> &buffer)
+{
+    return (const o3d::UInt8*)view.data >= buffer.data() &&
+           (const o3d::UInt8*)view.data + view.length <= buffer.data() + buffer.size();
+}
+
+//! Views into the buffer of the stream, valid across the next reads, into other records
+//! or the same one.
+void testReads()
+{
+    VectorOutStream os;
+    for (o3d::UInt32 i = 0; i < 8; ++i)
+    {
+        entry(i).writeToFile(os);
+    }
+
+    DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+
+    EntryData first;
+    first.readFromFile(is);
+
+    DataStringView firstLabel = first.getLabel();
+    o3d::String firstNote = first.getNoteString();
+
+    check(isInto(first.getLabel(), os.data) && isInto(first.getNote(), os.data), "views into the buffer");
+
+    // the next records into other objects, then into the first one
+    std::vector<EntryData> others(6);
+    for (EntryData &other : others)
+    {
+        other.readFromFile(is);
+    }
+
+    check(isEntry(first, 0), "views kept across the next reads");
+
+    for (o3d::UInt32 i = 0; i < others.size(); ++i)
+    {
+        check(isEntry(others[i], i + 1), "views of the next reads");
+    }
+
+    first.readFromFile(is);
+    check(isEntry(first, 7), "record read again");
+    check(firstLabel == DataStringView(label(0).c_str()), "copy of a view kept across a read again");
+
+    first.reset();
+    check(first.getLabel().isEmpty() && first.getNote().isEmpty(), "views reset");
+    check(isEntry(others[0], 1), "views kept across the reset of another record");
+
+    // no copy : the views see the buffer, the owning copy does not
+    std::memset(os.data.data(), '#', os.data.size());
+    check(others[0].getLabel() != DataStringView(label(1).c_str()), "views not copied");
+    check(firstNote == o3d::String(note(0).c_str()), "owning copy kept");
+}
+
+//! Views into the blocks of a pack, valid as long as the reader, whatever the next blocks.
+void testPack()
+{
+    VectorOutStream os;
+    DataPackWriter writer(os, 512);
+
+    for (o3d::UInt32 i = 0; i < 1000; ++i)
+    {
+        writer.write(entry(i));
+    }
+
+    writer.finish();
+
+    DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+    DataPackReader reader(is);
+
+    check(reader.getNumBlocks() > 2, "pack blocks");
+
+    std::vector<EntryData> first, second;
+    reader.readBlock(0, first);
+    reader.readBlock(1, second);
+
+    // the views point into the decompressed blocks, not into the packed stream
+    check(!first.empty() && !isInto(first[0].getLabel(), os.data), "views into the blocks");
+
+    // every block by threads, then the first one again
+    std::vector<EntryData> records;
+    reader.readAll(records, 4);
+
+    std::vector<EntryData> again;
+    reader.readBlock(0, again);
+
+    o3d::Bool same = first.size() == again.size();
+    for (o3d::UInt32 i = 0; same && i < first.size(); ++i)
+    {
+        same = isEntry(first[i], i) && isEntry(again[i], i);
+    }
+
+    check(same, "views of a block kept across the next blocks");
+
+    const DataPack::Block &block = reader.getBlock(1);
+    same = second.size() == block.numRecords;
+    for (o3d::UInt32 i = 0; same && i < second.size(); ++i)
+    {
+        same = isEntry(second[i], block.firstRecord + i);
+    }
+
+    check(same, "views of the second block kept");
+
+    same = records.size() == 1000;
+    for (o3d::UInt32 i = 0; same && i < records.size(); ++i)
+    {
+        same = isEntry(records[i], i);
+    }
+
+    check(same, "views of the blocks read by threads kept");
+}
+
+} // anonymous namespace
+
+int main()
+{
+    testReads();
+    testPack();
+
+    if (failures > 0)
+        return 1;
+
+    std::printf("stringview test passed\n");
+    return 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file main.cpp
+ * @brief Round-trip the variable length integers at their edge values, check their sizes,
+ * that the overlong and the truncated ones are rejected, and read them into CounterData.
+ * Return non-zero on failure.
+ * @author Frederic SCHERMA (frederic.scherma@dreamoverflow.org)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2001-2017 Dream Overflow. All rights reserved.
+ * @details
+ */
+
+#include "CounterData.h"
+#include "DataEncoding.h"
+
+#include <o3d/core/OutStream.h>
+
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+using namespace tsv;
+
+namespace {
+
+/**
+ * @brief Output stream appending to a vector.
+ */
+class VectorOutStream : public o3d::OutStream
+{
+public:
+
+    std::vector<o3d::UInt8> data;
+
+    virtual o3d::UInt32 writer(const void *buf, o3d::UInt32 size, o3d::UInt32 count)
+    {
+        const o3d::UInt8 *p = (const o3d::UInt8*)buf;
+        data.insert(data.end(), p, p + size * count);
+
+        return count;
+    }
+
+    virtual void close() {}
+    virtual void flush() {}
+    virtual void reset(o3d::UInt64 n) { data.resize((size_t)n); }
+    virtual void seek(o3d::Int64) {}
+    virtual void end(o3d::Int64) {}
+    virtual o3d::Int32 getPosition() const { return (o3d::Int32)data.size(); }
+};
+
+o3d::Int32 failures = 0;
+
+void check(o3d::Bool cond, const char *what)
+{
+    if (!cond)
+    {
+        std::printf("FAILED: %s\n", what);
+        ++failures;
+    }
+}
+
+//! Write v, check its encoded size, then read it back from the whole buffer.
+template <class T, class W, class R>
+void roundTrip(T v, o3d::UInt32 size, W write, R read, const char *what)
+{
+    VectorOutStream os;
+    write(os, v);
+    check(os.data.size() == size, what);
+
+    DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+    check(read(is) == v, what);
+    check(is.isEnd(), what);
+}
+
+void testEdgeValues()
+{
+    typedef std::numeric_limits<o3d::Int32> Int32Limits;
+    typedef std::numeric_limits<o3d::Int64> Int64Limits;
+
+    auto wu32 = [] (o3d::OutStream &os, o3d::UInt32 v) { writeVarUInt32(os, v); };
+    auto ru32 = [] (o3d::InStream &is) { return readVarUInt32(is); };
+    auto wi32 = [] (o3d::OutStream &os, o3d::Int32 v) { writeVarInt32(os, v); };
+    auto ri32 = [] (o3d::InStream &is) { return readVarInt32(is); };
+    auto wu64 = [] (o3d::OutStream &os, o3d::UInt64 v) { writeVarUInt64(os, v); };
+    auto ru64 = [] (o3d::InStream &is) { return readVarUInt64(is); };
+    auto wi64 = [] (o3d::OutStream &os, o3d::Int64 v) { writeVarInt64(os, v); };
+    auto ri64 = [] (o3d::InStream &is) { return readVarInt64(is); };
+
+    roundTrip<o3d::UInt32>(0, 1, wu32, ru32, "varuint32 0");
+    roundTrip<o3d::UInt32>(127, 1, wu32, ru32, "varuint32 127");
+    roundTrip<o3d::UInt32>(128, 2, wu32, ru32, "varuint32 128");
+    roundTrip<o3d::UInt32>(0xffffffff, 5, wu32, ru32, "varuint32 max");
+
+    roundTrip<o3d::Int32>(0, 1, wi32, ri32, "varint32 0");
+    roundTrip<o3d::Int32>(-1, 1, wi32, ri32, "varint32 -1");
+    roundTrip<o3d::Int32>(-64, 1, wi32, ri32, "varint32 -64");
+    roundTrip<o3d::Int32>(64, 2, wi32, ri32, "varint32 64");
+    roundTrip<o3d::Int32>(Int32Limits::min(), 5, wi32, ri32, "varint32 min");
+    roundTrip<o3d::Int32>(Int32Limits::max(), 5, wi32, ri32, "varint32 max");
+
+    roundTrip<o3d::UInt64>(0, 1, wu64, ru64, "varuint64 0");
+    roundTrip<o3d::UInt64>(0xffffffff, 5, wu64, ru64, "varuint64 32 bits");
+    roundTrip<o3d::UInt64>(0xffffffffffffffffULL, 10, wu64, ru64, "varuint64 max");
+
+    roundTrip<o3d::Int64>(0, 1, wi64, ri64, "varint64 0");
+    roundTrip<o3d::Int64>(-1, 1, wi64, ri64, "varint64 -1");
+    roundTrip<o3d::Int64>(Int64Limits::min(), 10, wi64, ri64, "varint64 min");
+    roundTrip<o3d::Int64>(Int64Limits::max(), 10, wi64, ri64, "varint64 max");
+
+    // zigzag order, so the small negative values stay short
+    check(zigzagEncode32(-1) == 1 && zigzagEncode32(1) == 2 && zigzagEncode32(-2) == 3, "zigzag 32");
+    check(zigzagEncode64(Int64Limits::min()) == 0xffffffffffffffffULL, "zigzag 64 min");
+}
+
+//! True if reading a var integer of bytes throws E_InvalidFormat.
+template <class R>
+o3d::Bool isRejected(const std::vector<o3d::UInt8> &bytes, R read)
+{
+    try {
+        DataMemoryInStream is(bytes.data(), (o3d::UInt32)bytes.size());
+        read(is);
+    } catch (const o3d::E_InvalidFormat &) {
+        return o3d::True;
+    }
+
+    return o3d::False;
+}
+
+void testRejected()
+{
+    auto ru32 = [] (o3d::InStream &is) { return readVarUInt32(is); };
+    auto ru64 = [] (o3d::InStream &is) { return readVarUInt64(is); };
+
+    // the longest valid ones, then a byte more
+    std::vector<o3d::UInt8> bytes32 = { 0xff, 0xff, 0xff, 0xff, 0x0f };
+    std::vector<o3d::UInt8> bytes64(9, 0xff);
+    bytes64.push_back(0x01);
+
+    check(!isRejected(bytes32, ru32), "varuint32 of 5 bytes accepted");
+    check(!isRejected(bytes64, ru64), "varuint64 of 10 bytes accepted");
+
+    check(isRejected(std::vector<o3d::UInt8>{ 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 }, ru32),
+          "varuint32 longer than 5 bytes rejected");
+
+    std::vector<o3d::UInt8> overlong64(10, 0x80);
+    overlong64.push_back(0x00);
+    check(isRejected(overlong64, ru64), "varuint64 longer than 10 bytes rejected");
+
+    // truncated, the last byte still has its high bit
+    check(isRejected(std::vector<o3d::UInt8>(), ru32), "empty varuint32 rejected");
+    check(isRejected(std::vector<o3d::UInt8>{ 0xff, 0xff }, ru32), "truncated varuint32 rejected");
+    check(isRejected(std::vector<o3d::UInt8>(bytes64.begin(), bytes64.end() - 1), ru64),
+          "truncated varuint64 rejected");
+}
+
+//! Written as CounterData reads it (the generator exports only the reader here).
+void writeCounter(o3d::OutStream &os, o3d::UInt32 id, o3d::Int32 delta, o3d::UInt64 size, o3d::Int64 offset)
+{
+    writeVarUInt32(os, id);
+    writeVarInt32(os, delta);
+    writeVarUInt64(os, size);
+    writeVarInt64(os, offset);
+}
+
+void testRecord()
+{
+    VectorOutStream os;
+    writeCounter(os, 0, -1, 0, -1);
+    writeCounter(os, 0xffffffff, std::numeric_limits<o3d::Int32>::min(),
+                 0xffffffffffffffffULL, std::numeric_limits<o3d::Int64>::min());
+
+    // 4 bytes, then 5 + 5 + 10 + 10
+    check(os.data.size() == 34, "counter sizes");
+
+    DataMemoryInStream is(os.data.data(), (o3d::UInt32)os.data.size());
+    CounterData counter;
+
+    counter.readFromFile(is);
+    check(counter.getId() == 0 && counter.getDelta() == -1 && counter.getSize() == 0 &&
+          counter.getOffset() == -1, "counter of small values");
+
+    counter.readFromFile(is);
+    check(counter.getId() == 0xffffffff && counter.getDelta() == std::numeric_limits<o3d::Int32>::min() &&
+          counter.getSize() == 0xffffffffffffffffULL &&
+          counter.getOffset() == std::numeric_limits<o3d::Int64>::min(), "counter of edge values");
+
+    check(is.isEnd(), "counters read");
+}
+
+} // anonymous namespace
+
+int main()
+{
+    testEdgeValues();
+    testRejected();
+    testRecord();
+
+    if (failures > 0)
+        return 1;
+
+    std::printf("varint test passed\n");
+    return 0;
+}